@@ -0,0 +1,158 @@
+#ifndef WEBXX_CATALOG_H
+#define WEBXX_CATALOG_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// Catalog: placeholder keys declared at compile time (e.g. for i18n).
+
+#include <array>
+#include <iterator>
+#include <stdexcept>
+
+#include "core.h"
+
+
+////|           |////
+////|  Catalog  |////
+////|           |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    // The indexes of the keys, in the order of the keys:
+    template<const auto& KEYS>
+    constexpr std::array<std::size_t, std::size(KEYS)> sortedKeyOrder () {
+        std::array<std::size_t, std::size(KEYS)> sorted{};
+        for (std::size_t i = 0; i < sorted.size(); ++i) {
+            std::size_t j = i;
+            for (; j > 0 && std::string_view{KEYS[i]} < std::string_view{KEYS[sorted[j - 1]]}; --j) {
+                sorted[j] = sorted[j - 1];
+            }
+            sorted[j] = i;
+        }
+        return sorted;
+    }
+
+    template<const auto& KEYS>
+    constexpr bool keysAreUnique (const std::array<std::size_t, std::size(KEYS)>& order) {
+        for (std::size_t i = 1; i < order.size(); ++i) {
+            if (std::string_view{KEYS[order[i - 1]]} == std::string_view{KEYS[order[i]]}) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // A fixed set of placeholder keys, declared once as an array with static
+    // storage duration. Keys are found by index at compile time, so a key
+    // that isn't in the catalog fails to compile:
+    //
+    //   inline constexpr std::string_view navKeys[] = {"nav.home", "nav.about"};
+    //   using Nav = catalog<navKeys>;
+    //   li{Nav::key<Nav::index("nav.home")>()};
+    template<const auto& KEYS>
+    struct KeyCatalog {
+        static constexpr std::size_t size = std::size(KEYS);
+
+        private:
+
+        static constexpr std::array<std::size_t, size> order{sortedKeyOrder<KEYS>()};
+        static_assert(keysAreUnique<KEYS>(order), "The keys of a catalog must be unique");
+
+        static constexpr std::size_t notFound{SIZE_MAX};
+
+        static constexpr std::size_t find (const std::string_view& key) {
+            std::size_t low = 0;
+            std::size_t high = size;
+            while (low < high) {
+                const std::size_t middle = low + (high - low) / 2;
+                const std::string_view found{KEYS[order[middle]]};
+                if (found == key) {
+                    return order[middle];
+                } else if (found < key) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            return notFound;
+        }
+
+        // Registered with the placeholder catalog on first use:
+        static const std::array<PlaceholderSlot, size>& slots () {
+            static const std::array<PlaceholderSlot, size> registered = [] () {
+                std::array<PlaceholderSlot, size> tSlots{};
+                for (std::size_t i = 0; i < size; ++i) {
+                    tSlots[i] = placeholderCatalog().enter(KEYS[i]).slot;
+                }
+                return tSlots;
+            }();
+            return registered;
+        }
+
+        public:
+
+        // Only usable as a constant where the key is in the catalog:
+        static constexpr std::size_t index (const std::string_view& key) {
+            const std::size_t found = find(key);
+            if (found == notFound) {
+                throw std::out_of_range("webxx: key is not in the catalog");
+            }
+            return found;
+        }
+
+        template<std::size_t I>
+        static PlaceholderKey key () {
+            static_assert(I < size, "Catalog index is out of range");
+            return {slots()[I], KEYS[I]};
+        }
+
+        // Build the table of values for one locale from "key=value" lines,
+        // such as the contents of a file read or mapped into memory at
+        // startup. The values are views into the contents, which must
+        // outlive the table. Blank lines, lines beginning with "#" & keys
+        // that aren't in the catalog are skipped:
+        static PlaceholderValues values (const std::string_view& contents) {
+            PlaceholderValues table;
+            std::size_t start = 0;
+            while (start < contents.size()) {
+                std::size_t end = contents.find('\n', start);
+                if (end == std::string_view::npos) {
+                    end = contents.size();
+                }
+                std::string_view line = contents.substr(start, end - start);
+                start = end + 1;
+
+                if (!line.empty() && line.back() == '\r') {
+                    line.remove_suffix(1);
+                }
+                const std::size_t separator = line.find('=');
+                if (line.empty() || line.front() == '#' || separator == std::string_view::npos) {
+                    continue;
+                }
+                const std::size_t found = find(line.substr(0, separator));
+                if (found == notFound) {
+                    continue;
+                }
+
+                const PlaceholderSlot slot = slots()[found];
+                if (slot >= table.size()) {
+                    table.resize(slot + std::size_t{1});
+                }
+                table[slot] = line.substr(separator + 1);
+            }
+            return table;
+        }
+    };
+
+    namespace exports {
+        template<const auto& KEYS>
+        using catalog = KeyCatalog<KEYS>;
+    }
+}}
+
+#endif // WEBXX_CATALOG_H
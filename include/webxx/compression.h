@@ -0,0 +1,285 @@
+#ifndef WEBXX_COMPRESSION_H
+#define WEBXX_COMPRESSION_H
+
+// Optional streaming compression for webxx render output. Requires zlib
+// (enable with the WEBXX_ZLIB CMake option, or link zlib yourself).
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <zlib.h>
+#include "core.h"
+
+
+////|               |////
+////|  Compression  |////
+////|               |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    enum class CompressionFormat {
+        GZIP = 0,       // RFC 1952, for "Content-Encoding: gzip".
+        ZLIB = 1,       // RFC 1950, for "Content-Encoding: deflate".
+        DEFLATE = 2,    // RFC 1951 raw deflate, no header or trailer.
+    };
+
+    struct CompressionOptions {
+        CompressionFormat format{CompressionFormat::GZIP};
+        int level{Z_DEFAULT_COMPRESSION};
+        // Input bytes after which the stream is sync-flushed to the receiver (0 = only on flush()/finish()):
+        std::size_t flushSize{renderBufferDefaultSize};
+    };
+
+    // A block of raw deflate data that begins and ends on a full flush
+    // boundary, so that it can be spliced into any compressed stream:
+    struct CompressedSegment {
+        std::string bytes;
+        std::size_t length{0};
+        uLong crc{0};
+        uLong adler{1};
+    };
+
+    // Deflate all of the input into out, a chunk at a time. zlib counts
+    // bytes with uInt, so larger inputs are fed to it in slices, only the
+    // last of which is flushed with the given mode:
+    inline void deflateAll (z_stream& stream, const Bytef* in, std::size_t size, const int flushMode, std::string& out) {
+        constexpr std::size_t chunkSize{16 * 1024};
+        constexpr std::size_t sliceSize{std::numeric_limits<uInt>::max()};
+        Bytef chunk[chunkSize];
+        do {
+            const std::size_t slice = std::min(size, sliceSize);
+            const int mode = (slice == size) ? flushMode : Z_NO_FLUSH;
+            stream.next_in = const_cast<Bytef*>(in);
+            stream.avail_in = static_cast<uInt>(slice);
+            do {
+                stream.next_out = chunk;
+                stream.avail_out = static_cast<uInt>(chunkSize);
+                if (deflate(&stream, mode) == Z_STREAM_ERROR) {
+                    throw std::runtime_error("webxx: zlib deflate stream error");
+                }
+                out.append(reinterpret_cast<const char*>(chunk), chunkSize - stream.avail_out);
+            } while (stream.avail_out == 0 || stream.avail_in > 0);
+            in += slice;
+            size -= slice;
+        } while (size);
+    }
+
+    typedef std::function<void(const std::string_view&)> CompressedReceiverFn;
+
+    class Compressor {
+        public:
+
+        Compressor (CompressedReceiverFn tReceiverFn = {}, CompressionOptions tOptions = {}) :
+            receiverFn{std::move(tReceiverFn)},
+            options{tOptions},
+            stream{},
+            staged{},
+            pending{},
+            unflushed{0},
+            length{0},
+            crc{crc32(0, nullptr, 0)},
+            adler{adler32(0, nullptr, 0)},
+            finished{false}
+        {
+            if (deflateInit2(&stream, options.level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+                throw std::runtime_error("webxx: unable to initialise zlib deflate stream");
+            }
+            writeHeader();
+        }
+
+        Compressor (Compressor&&) = delete;
+        Compressor& operator= (Compressor&&) = delete;
+        Compressor (const Compressor&) = delete;
+        Compressor& operator= (const Compressor&) = delete;
+
+        ~Compressor () {
+            deflateEnd(&stream);
+        }
+
+        // Compress rendered data, sync-flushing whenever flushSize is reached:
+        void write (const std::string_view& data) {
+            staged.append(data);
+            unflushed += data.size();
+            if (options.flushSize && unflushed >= options.flushSize) {
+                flush();
+            } else if (staged.size() >= stagedMaxSize) {
+                deflateStaged(Z_NO_FLUSH);
+            }
+        }
+
+        // Splice in a pre-compressed segment without recompressing it:
+        void write (const CompressedSegment& segment) {
+            if (segment.length == 0) {
+                return;
+            }
+            // Reset the dictionary so that no later block refers back across the segment:
+            deflateStaged(Z_FULL_FLUSH);
+            pending.append(segment.bytes);
+            crc = crc32_combine(crc, segment.crc, static_cast<z_off_t>(segment.length));
+            adler = adler32_combine(adler, segment.adler, static_cast<z_off_t>(segment.length));
+            length += segment.length;
+            unflushed = 0;
+            emit();
+        }
+
+        // Emit everything written so far as a complete (decodable) prefix:
+        void flush () {
+            deflateStaged(Z_SYNC_FLUSH);
+            unflushed = 0;
+            emit();
+        }
+
+        // Terminate the stream, writing the format trailer:
+        void finish () {
+            if (finished) {
+                return;
+            }
+            deflateStaged(Z_FINISH);
+            writeTrailer();
+            finished = true;
+            unflushed = 0;
+            emit();
+        }
+
+        // Adapts this compressor so it can be passed as a render receiver:
+        RenderReceiverFn receiver () {
+            return [this] (const std::string_view& data, std::string&) {
+                write(data);
+            };
+        }
+
+        // Adapts this compressor so that render flush points sync-flush it:
+        RenderFlushFn flusher () {
+            return [this] (std::string&) {
+                flush();
+            };
+        }
+
+        // Compressed output, when no receiver function was provided:
+        const std::string& output () const {
+            return collected;
+        }
+
+        private:
+
+        // Rendered fragments are tiny, so they are batched up before being deflated:
+        static constexpr std::size_t stagedMaxSize{4 * 1024};
+
+        CompressedReceiverFn receiverFn;
+        CompressionOptions options;
+        z_stream stream;
+        std::string staged;
+        std::string pending;
+        std::string collected;
+        std::size_t unflushed;
+        std::size_t length;
+        uLong crc;
+        uLong adler;
+        bool finished;
+
+        void deflateStaged (int flushMode) {
+            const Bytef* bytes = reinterpret_cast<const Bytef*>(staged.data());
+
+            crc = crc32_z(crc, bytes, staged.size());
+            adler = adler32_z(adler, bytes, staged.size());
+            length += staged.size();
+
+            deflateAll(stream, bytes, staged.size(), flushMode, pending);
+            staged.clear();
+        }
+
+        void emit () {
+            if (pending.empty()) {
+                return;
+            }
+            if (receiverFn) {
+                receiverFn(pending);
+            } else {
+                collected.append(pending);
+            }
+            pending.clear();
+        }
+
+        void writeByte (std::size_t value) {
+            pending.push_back(static_cast<char>(value & 0xff));
+        }
+
+        void writeHeader () {
+            switch (options.format) {
+                case CompressionFormat::GZIP:
+                    for (unsigned long byte : {0x1ful, 0x8bul, 0x08ul, 0ul, 0ul, 0ul, 0ul, 0ul, 0ul, 0xfful}) {
+                        writeByte(byte);
+                    }
+                    break;
+                case CompressionFormat::ZLIB: {
+                    const unsigned long cmf = 0x78;
+                    const unsigned long level = (options.level >= 0 && options.level < 2) ? 0
+                        : (options.level >= 2 && options.level < 6) ? 1
+                        : (options.level == 6 || options.level == Z_DEFAULT_COMPRESSION) ? 2
+                        : 3;
+                    unsigned long flg = level << 6;
+                    flg += 31 - ((cmf * 256 + flg) % 31);
+                    writeByte(cmf);
+                    writeByte(flg);
+                    break;
+                }
+                case CompressionFormat::DEFLATE:
+                    break;
+            }
+        }
+
+        void writeTrailer () {
+            switch (options.format) {
+                case CompressionFormat::GZIP:
+                    for (int shift = 0; shift < 32; shift += 8) {
+                        writeByte(crc >> shift);
+                    }
+                    for (int shift = 0; shift < 32; shift += 8) {
+                        writeByte(length >> shift);
+                    }
+                    break;
+                case CompressionFormat::ZLIB:
+                    for (int shift = 24; shift >= 0; shift -= 8) {
+                        writeByte(adler >> shift);
+                    }
+                    break;
+                case CompressionFormat::DEFLATE:
+                    break;
+            }
+        }
+    };
+
+    inline CompressedSegment compressSegment (const std::string_view& data, int level = Z_BEST_COMPRESSION) {
+        CompressedSegment segment;
+        const Bytef* bytes = reinterpret_cast<const Bytef*>(data.data());
+        segment.length = data.size();
+        segment.crc = crc32_z(crc32(0, nullptr, 0), bytes, data.size());
+        segment.adler = adler32_z(adler32(0, nullptr, 0), bytes, data.size());
+
+        z_stream stream{};
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            throw std::runtime_error("webxx: unable to initialise zlib deflate stream");
+        }
+        // A full flush (rather than finishing) leaves the block open-ended and byte aligned:
+        try {
+            deflateAll(stream, bytes, data.size(), Z_FULL_FLUSH, segment.bytes);
+        } catch (...) {
+            deflateEnd(&stream);
+            throw;
+        }
+        deflateEnd(&stream);
+
+        return segment;
+    }
+
+    namespace exports {
+        using compressor = Compressor;
+        using compressedSegment = CompressedSegment;
+        using compressionFormat = CompressionFormat;
+        using compressionOptions = CompressionOptions;
+        using internal::compressSegment;
+    }
+}}
+
+
+#endif // WEBXX_COMPRESSION_H
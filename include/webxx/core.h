@@ -0,0 +1,3765 @@
+#ifndef WEBXX_CORE_H
+#define WEBXX_CORE_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#define WEBXX_CSS_PROP(NAME)\
+    namespace internal { namespace res { inline constexpr char NAME ## P[] = #NAME; }}\
+    using NAME = internal::CssProperty<internal::res::NAME ## P>
+#define WEBXX_CSS_PROP_ALIAS(NAME,ALIAS)\
+    namespace internal { namespace res { inline constexpr char ALIAS ## P[] = #NAME; }}\
+    using ALIAS = internal::CssProperty<internal::res::ALIAS ## P>
+#define WEBXX_CSS_AT_SINGLE(NAME,ALIAS)\
+    namespace internal { namespace res { inline constexpr char ALIAS ## CA[] = #NAME; }}\
+    using ALIAS = internal::CssAtSingle<internal::res::ALIAS ## CA>
+#define WEBXX_CSS_AT_NESTED(NAME,ALIAS)\
+    namespace internal { namespace res { inline constexpr char ALIAS ## CA[] = #NAME; }}\
+    using ALIAS = internal::CssAtNested<internal::res::ALIAS ## CA>
+#define WEBXX_HTML_STANDARD_EL(TAG)\
+    using TAG = internal::HtmlNodeDefined<internal::StandardName<internal::HtmlTag::TAG>>
+#define WEBXX_HTML_STANDARD_EL_ALIAS(TAG,ALIAS)\
+    using ALIAS = internal::HtmlNodeDefined<internal::StandardName<internal::HtmlTag::ALIAS>>
+#define WEBXX_HTML_STANDARD_ATTR(NAME)\
+    using _ ## NAME = internal::HtmlAttributeDefined<internal::StandardName<internal::HtmlAttr::_ ## NAME>>
+#define WEBXX_HTML_STANDARD_ATTR_ALIAS(NAME,ALIAS)\
+    using _ ## ALIAS = internal::HtmlAttributeDefined<internal::StandardName<internal::HtmlAttr::_ ## ALIAS>>
+// For elements & attributes outside of the standard tables (given IDs on first use):
+#define WEBXX_HTML_EL(TAG)\
+    namespace internal { namespace res { inline constexpr char TAG ## T[] = #TAG; }}\
+    using TAG = internal::HtmlNodeDefined<internal::CustomName<internal::HtmlTag, internal::res::TAG ## T>>
+#define WEBXX_HTML_EL_ALIAS(TAG,ALIAS)\
+    namespace internal { namespace res { inline constexpr char ALIAS ## T[] = #TAG; }}\
+    using ALIAS = internal::HtmlNodeDefined<internal::CustomName<internal::HtmlTag, internal::res::ALIAS ## T>>
+#define WEBXX_HTML_EL_SELF_CLOSING(TAG)\
+    namespace internal { namespace res { inline constexpr char TAG ## T[] = #TAG; }}\
+    using TAG = internal::HtmlNodeDefined<internal::CustomName<internal::HtmlTag, internal::res::TAG ## T, internal::VOID_ELEMENT>>
+#define WEBXX_HTML_ATTR(NAME)\
+    namespace internal { namespace res { inline constexpr char NAME ## A[] = #NAME; }}\
+    using _ ## NAME = internal::HtmlAttributeDefined<internal::CustomName<internal::HtmlAttr, internal::res::NAME ## A>>
+#define WEBXX_HTML_ATTR_ALIAS(NAME,ALIAS)\
+    namespace internal { namespace res { inline constexpr char ALIAS ## A[] = #NAME; }}\
+    using _ ## ALIAS = internal::HtmlAttributeDefined<internal::CustomName<internal::HtmlAttr, internal::res::ALIAS ## A>>
+#define WEBXX_MOVE_ONLY_CONSTRUCTORS(CLASS)\
+    CLASS (CLASS &&) = default;\
+    CLASS & operator= (CLASS &&) = default;\
+    CLASS (const CLASS &) = delete;\
+    CLASS & operator= (const CLASS &) = delete;
+#ifdef _MSC_VER
+#define WEBXX_FN_SIG __FUNCSIG__
+#else
+#define WEBXX_FN_SIG __PRETTY_FUNCTION__
+#endif
+#ifdef WEBXX_INSTRUMENT
+#include <chrono>
+#define WEBXX_OBSERVE(STATS,CALL) if (STATS) { (STATS)->CALL; }
+#else
+#define WEBXX_OBSERVE(STATS,CALL)
+#endif
+#ifndef WEBXX_CUSTOM_NAME_CAPACITY
+#define WEBXX_CUSTOM_NAME_CAPACITY 256
+#endif
+#ifndef WEBXX_EXPORT
+#define WEBXX_EXPORT
+#endif
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    inline constexpr char none[] = "";
+}}
+
+
+////|              |////
+////|  Containers  |////
+////|              |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    // A vector which stores up to N elements inline, only allocating when it
+    // grows beyond them. Like the nodes it holds, it is move-only:
+    template<class T, std::size_t N>
+    class SmallVector {
+        static_assert(N > 0, "SmallVector needs an inline capacity");
+
+        public:
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+
+        SmallVector () noexcept :
+            first{inlineData()},
+            length{0},
+            capacity{N}
+        {}
+        SmallVector (std::initializer_list<T> items) : SmallVector() {
+            reserve(items.size());
+            for (auto& item : items) {
+                new (first + length++) T(item);
+            }
+        }
+        SmallVector (std::vector<T>&& items) : SmallVector() {
+            reserve(items.size());
+            for (auto& item : items) {
+                new (first + length++) T(std::move(item));
+            }
+        }
+        SmallVector (SmallVector&& other) : SmallVector() {
+            take(other);
+        }
+        SmallVector& operator= (SmallVector&& other) {
+            if (this != &other) {
+                reset();
+                take(other);
+            }
+            return *this;
+        }
+        SmallVector (const SmallVector&) = delete;
+        SmallVector& operator= (const SmallVector&) = delete;
+
+        ~SmallVector () {
+            reset();
+        }
+
+        iterator begin () { return first; }
+        iterator end () { return first + length; }
+        const_iterator begin () const { return first; }
+        const_iterator end () const { return first + length; }
+        std::size_t size () const { return length; }
+        bool empty () const { return length == 0; }
+        T& operator[] (const std::size_t index) { return first[index]; }
+        const T& operator[] (const std::size_t index) const { return first[index]; }
+        T& back () { return first[length - 1]; }
+        const T& back () const { return first[length - 1]; }
+
+        void reserve (const std::size_t tCapacity) {
+            if (tCapacity <= capacity) {
+                return;
+            }
+            T* grown = static_cast<T*>(::operator new(tCapacity * sizeof(T)));
+            for (std::uint32_t i = 0; i < length; ++i) {
+                new (grown + i) T(std::move(first[i]));
+                first[i].~T();
+            }
+            if (first != inlineData()) {
+                ::operator delete(first);
+            }
+            first = grown;
+            capacity = static_cast<std::uint32_t>(tCapacity);
+        }
+
+        template<class... A>
+        T& emplace_back (A&&... args) {
+            if (length == capacity) {
+                reserve(std::size_t{capacity} * 2);
+            }
+            return *new (first + length++) T(std::forward<A>(args)...);
+        }
+        void push_back (T&& item) {
+            emplace_back(std::move(item));
+        }
+        void pop_back () {
+            first[--length].~T();
+        }
+
+        private:
+        T* first;
+        std::uint32_t length;
+        std::uint32_t capacity;
+        alignas(T) unsigned char storage[N * sizeof(T)];
+
+        T* inlineData () {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        void reset () {
+            for (std::uint32_t i = 0; i < length; ++i) {
+                first[i].~T();
+            }
+            if (first != inlineData()) {
+                ::operator delete(first);
+            }
+            first = inlineData();
+            length = 0;
+            capacity = N;
+        }
+
+        // Takes the other's heap buffer if it has one, or moves its inline elements:
+        void take (SmallVector& other) {
+            if (other.first != other.inlineData()) {
+                first = other.first;
+                capacity = other.capacity;
+                length = other.length;
+                other.first = other.inlineData();
+                other.capacity = N;
+                other.length = 0;
+            } else {
+                for (std::uint32_t i = 0; i < other.length; ++i) {
+                    new (first + i) T(std::move(other.first[i]));
+                }
+                length = other.length;
+                other.reset();
+            }
+        }
+    };
+}}
+
+
+////|              |////
+////| Placeholders |////
+////|              |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    class Placeholder : public std::string {
+        public:
+        using std::string::string;
+    };
+
+    using PlaceholderPopulator = std::function<const std::string_view(
+        const std::string_view&,
+        const std::string_view&
+    )>;
+
+    inline const std::string_view noopPopulator (
+        const std::string_view& value,
+        const std::string_view&
+    ) {
+        return value;
+    }
+
+    template<typename T>
+    inline constexpr bool isWritableNumber = std::is_integral<T>::value
+        && !std::is_same<T, bool>::value
+        && !std::is_same<T, char>::value
+        && !std::is_same<T, wchar_t>::value
+#ifdef __cpp_char8_t
+        && !std::is_same<T, char8_t>::value
+#endif
+        && !std::is_same<T, char16_t>::value
+        && !std::is_same<T, char32_t>::value;
+
+    // Given to a placeholder writer, to append its output straight to the
+    // render (rather than returning a view of storage that must outlive it):
+    class PlaceholderWriter {
+        void* renderer;
+        void (*sendFn)(void*, const std::string_view&);
+
+        public:
+        PlaceholderWriter (void* tRenderer, void (*tSendFn)(void*, const std::string_view&)) :
+            renderer{tRenderer}, sendFn{tSendFn} {}
+
+        PlaceholderWriter& operator<< (const std::string_view& text) {
+            sendFn(renderer, text);
+            return *this;
+        }
+
+        PlaceholderWriter& operator<< (const char* const text) {
+            return *this << std::string_view{text};
+        }
+
+        PlaceholderWriter& operator<< (const char character) {
+            return *this << std::string_view{&character, 1};
+        }
+
+        // Integers are written as digits (std::int8_t & std::uint8_t too),
+        // but bool & wide character types have no single obvious rendering:
+        template<typename T, typename = std::enable_if_t<isWritableNumber<T>>>
+        PlaceholderWriter& operator<< (const T number) {
+            char digits[24];
+            const auto result = std::to_chars(digits, digits + sizeof(digits), number);
+            return *this << std::string_view{digits, static_cast<std::size_t>(result.ptr - digits)};
+        }
+    };
+
+    using PlaceholderWriterFn = std::function<void(
+        const std::string_view&,
+        const std::string_view&,
+        PlaceholderWriter&
+    )>;
+
+    // Registered placeholder keys are interned into slots, which index a flat
+    // table of values (e.g. one per locale), so they can be populated without
+    // a lookup by string:
+    typedef std::uint32_t PlaceholderSlot;
+    typedef std::vector<std::string_view> PlaceholderValues;
+    inline constexpr PlaceholderSlot noPlaceholderSlot{UINT32_MAX};
+
+    struct PlaceholderKey {
+        PlaceholderSlot slot;
+        std::string_view key;
+    };
+
+    // Keys are looked up without locking, as every placeholder does so: they
+    // are held in an insert-only, open-addressed table, which is replaced by
+    // a copy of twice the size once half full. Replaced tables are kept for
+    // the life of the catalog, as lookups may still be probing them:
+    class PlaceholderCatalog {
+        struct Entry {
+            std::atomic<const std::string*> key;
+            PlaceholderSlot slot;
+        };
+
+        struct Table {
+            std::unique_ptr<Entry[]> entries;
+            std::size_t mask;
+
+            explicit Table (const std::size_t capacity) :
+                entries{new Entry[capacity]()}, mask{capacity - 1}
+            {}
+
+            // The entry holding the key, or the empty one it would be added to:
+            Entry& probe (const std::string_view& key) const {
+                std::size_t i = std::hash<std::string_view>{}(key) & mask;
+                for (;; i = (i + 1) & mask) {
+                    const std::string* stored = entries[i].key.load(std::memory_order_acquire);
+                    if (!stored || *stored == key) {
+                        return entries[i];
+                    }
+                }
+            }
+
+            void add (const std::string& key, const PlaceholderSlot slot) {
+                Entry& entry = probe(key);
+                entry.slot = slot;
+                // Published after its slot, for lookups that find the key:
+                entry.key.store(&key, std::memory_order_release);
+            }
+        };
+
+        std::mutex mutex;
+        std::deque<std::string> keys;
+        std::vector<std::unique_ptr<Table>> tables;
+        std::atomic<const Table*> table;
+
+        void grow () {
+            auto grown = std::make_unique<Table>(tables.empty() ? std::size_t{64} : (tables.back()->mask + 1) * 2);
+            for (std::size_t slot = 0; slot < keys.size(); ++slot) {
+                grown->add(keys[slot], static_cast<PlaceholderSlot>(slot));
+            }
+            table.store(grown.get(), std::memory_order_release);
+            tables.push_back(std::move(grown));
+        }
+
+        public:
+        PlaceholderCatalog () : mutex{}, keys{}, tables{}, table{nullptr} {}
+
+        // The slot of a registered key, without registering unknown ones
+        // (which would otherwise accumulate from dynamic placeholders):
+        PlaceholderSlot find (const std::string_view& key) const {
+            const Table* current = table.load(std::memory_order_acquire);
+            if (!current) {
+                return noPlaceholderSlot;
+            }
+            const Entry& entry = current->probe(key);
+            return entry.key.load(std::memory_order_acquire) ? entry.slot : noPlaceholderSlot;
+        }
+
+        PlaceholderKey enter (const std::string_view& key) {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (!tables.empty()) {
+                const Entry& entry = tables.back()->probe(key);
+                if (const std::string* stored = entry.key.load(std::memory_order_relaxed)) {
+                    return {entry.slot, *stored};
+                }
+            }
+            if (tables.empty() || (keys.size() + 1) * 2 > tables.back()->mask + 1) {
+                grow();
+            }
+            const std::string& stored = keys.emplace_back(key);
+            const PlaceholderSlot slot = static_cast<PlaceholderSlot>(keys.size() - 1);
+            tables.back()->add(stored, slot);
+            return {slot, stored};
+        }
+    };
+
+    inline PlaceholderCatalog& placeholderCatalog () {
+        static PlaceholderCatalog catalog;
+        return catalog;
+    }
+
+    namespace exports {
+        using PlaceholderPopulator = PlaceholderPopulator;
+        using PlaceholderWriter = PlaceholderWriter;
+        using PlaceholderWriterFn = PlaceholderWriterFn;
+        using PlaceholderValues = PlaceholderValues;
+        using PlaceholderKey = PlaceholderKey;
+        using _ = Placeholder;
+
+        // Register a key once (e.g. as a static), to use as a placeholder:
+        inline PlaceholderKey placeholderKey (const std::string_view& key) {
+            return placeholderCatalog().enter(key);
+        }
+
+        // Build the table of values for a map of keys to values (such as
+        // the translations of one locale), registering each of the keys.
+        // Keys missing from the table are left to the placeholder populator:
+        template<class M>
+        PlaceholderValues placeholderValues (const M& values) {
+            PlaceholderValues table;
+            for (const auto& [key, value] : values) {
+                const PlaceholderSlot slot = placeholderCatalog().enter(key).slot;
+                if (slot >= table.size()) {
+                    table.resize(slot + std::size_t{1});
+                }
+                table[slot] = value;
+            }
+            return table;
+        }
+    }
+}}
+
+
+////|      |////
+////| Text |////
+////|      |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    struct Text {
+        enum class Type {
+            LITERAL = 0,
+            PLACEHOLDER = 1,
+        };
+
+        Type type;
+        PlaceholderSlot slot;
+        mutable std::optional<std::string> data;
+        std::string_view view;
+
+        Text (Text&& other) :               // move construct
+            type{other.type},
+            slot{other.slot},
+            data{std::move(other.data)},
+            view{data ? *data : other.view}
+        {}
+        Text& operator= (Text&& other) {    // move assign
+            this->type = other.type;
+            this->slot = other.slot;
+            this->data = std::move(other.data);
+            this->view = this->data ? *(this->data) : other.view;
+            return *this;
+        }
+        Text (const Text& other) :          // copy construct
+            type{other.type},
+            slot{other.slot},
+            data{std::move(other.data)},
+            view{data ? *data : other.view}
+        {}
+        Text& operator= (Text& other) {     // copy assign
+            this->type = other.type;
+            this->slot = other.slot;
+            this->data = std::move(other.data);
+            this->view = this->data ? *(this->data) : other.view;
+            return *this;
+        }
+
+        constexpr Text () : // empty
+            type{Type::LITERAL},
+            slot{noPlaceholderSlot},
+            data{},
+            view{none}
+        {}
+        Text (std::string&& value) : // own
+            type{Type::LITERAL},
+            slot{noPlaceholderSlot},
+            data{std::move(value)},
+            view{*data}
+        {}
+        constexpr Text (const char* const value) : // view
+            type{Type::LITERAL},
+            slot{noPlaceholderSlot},
+            data{},
+            view{value}
+        {}
+        Text (const std::string& value) : // own
+            type{Type::LITERAL},
+            slot{noPlaceholderSlot},
+            data{value},
+            view{*data}
+        {}
+        Text (const std::string_view value) : // view
+            type{Type::LITERAL},
+            slot{noPlaceholderSlot},
+            data{},
+            view{value}
+        {}
+        Text (Placeholder&& tPlaceholder) : // own
+            type{Type::PLACEHOLDER},
+            slot{placeholderCatalog().find(tPlaceholder)},
+            data{std::move(tPlaceholder)},
+            view{*data}
+        {}
+        constexpr Text (const PlaceholderKey& tKey) : // view
+            type{Type::PLACEHOLDER},
+            slot{tKey.slot},
+            data{},
+            view{tKey.key}
+        {}
+    };
+}}
+
+
+////|       |////
+////|  CSS  |////
+////|       |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    typedef SmallVector<Text, 1> CssSelectors;
+
+    struct CssRule {
+        struct Data {
+            bool canNest;
+            const char* label;
+            Text value;
+            CssSelectors selectors;
+            std::vector<CssRule> children;
+
+            WEBXX_MOVE_ONLY_CONSTRUCTORS(Data)
+
+            Data (
+                bool tCanNest = false,
+                const char* tLabel = none,
+                Text&& tValue = none,
+                CssSelectors&& tSelectors = {},
+                std::vector<CssRule>&& tChildren = {}
+            ) :
+                canNest{tCanNest},
+                label{tLabel},
+                value{std::move(tValue)},
+                selectors{std::move(tSelectors)},
+                children{std::move(tChildren)}
+            {}
+        };
+
+        mutable Data data;
+
+        CssRule (CssRule&&) = default;            // move construct
+        CssRule& operator= (CssRule&&) = default; // move assign
+        CssRule (const CssRule& other) : data {   // copy construct
+            std::move(other.data)
+        } {}
+        CssRule& operator= (CssRule& other) {     // copy assign
+            this->data = std::move(other.data);
+            return *this;
+        }
+
+        CssRule (Text&& tSelector) : data {
+            true,
+            none,
+            {},
+            {std::move(tSelector)},
+            {},
+        } {}
+        CssRule (std::initializer_list<Text>&& tSelectors) : data {
+            true,
+            none,
+            {},
+            std::move(tSelectors),
+            {},
+        } {}
+        CssRule (Text&& tSelector, std::initializer_list<CssRule>&& tRules) : data {
+            true,
+            none,
+            {},
+            {std::move(tSelector)},
+            std::move(tRules),
+        } {}
+        CssRule (std::initializer_list<Text>&& tSelectors, std::initializer_list<CssRule>&& tRules) : data {
+            true,
+            none,
+            {},
+            std::move(tSelectors),
+            std::move(tRules),
+        } {}
+        template <class... T, class = CssRule>
+        CssRule (Text&& tSelector, T&& ...tRules) : data {
+            true,
+            none,
+            {},
+            {std::move(tSelector)},
+            {std::forward<T>(tRules)...},
+        } {}
+        template <class... T, class = CssRule>
+        CssRule (std::initializer_list<Text>&& tSelectors, T&& ...tRules) : data {
+            true,
+            none,
+            {},
+            std::move(tSelectors),
+            {std::forward<T>(tRules)...},
+        } {}
+
+        CssRule (
+            bool tCanNest = false,
+            const char* tLabel = none,
+            Text&& tValue = {},
+            CssSelectors&& tSelectors = {},
+            std::vector<CssRule>&& tChildren = {}
+        ) : data {
+            tCanNest,
+            tLabel,
+            std::move(tValue),
+            std::move(tSelectors),
+            std::move(tChildren),
+        } {}
+    };
+
+    template<const char* const NAME>
+    struct CssProperty : CssRule {
+        CssProperty (Text&& tValue) :
+            CssRule(false, NAME, std::move(tValue), {}, {})
+        {}
+    };
+
+    template<const char* const PREFIX>
+    struct CssAtSingle : CssRule {
+        CssAtSingle (Text&& tSelector) :
+            CssRule(false, PREFIX, {}, {std::move(tSelector)}, {})
+        {}
+        CssAtSingle (std::initializer_list<Text>&& tSelectors) :
+            CssRule(false, PREFIX, {}, std::move(tSelectors), {})
+        {}
+    };
+
+    template<const char* const PREFIX>
+    struct CssAtNested : CssRule {
+        CssAtNested () :
+            CssRule(true, PREFIX, {}, {}, {})
+        {}
+        CssAtNested (Text&& tSelector) :
+            CssRule(true, PREFIX, {}, {std::move(tSelector)}, {})
+        {}
+        CssAtNested (std::initializer_list<Text>&& tSelectors) :
+            CssRule(true, PREFIX, {}, std::move(tSelectors), {})
+        {}
+        CssAtNested (Text&& tSelector, std::initializer_list<CssRule>&& tRules) :
+            CssRule(
+                true,
+                PREFIX,
+                {},
+                {std::move(tSelector)},
+                std::move(tRules)
+            )
+        {}
+        CssAtNested (std::initializer_list<Text>&& tSelectors, std::initializer_list<CssRule>&& tRules) :
+            CssRule(
+                true,
+                PREFIX,
+                {},
+                std::move(tSelectors),
+                std::move(tRules)
+            )
+        {}
+        template <class... T, class = CssRule>
+        CssAtNested (Text&& tSelector, T&& ...tRules) :
+            CssRule(
+                true,
+                PREFIX,
+                {},
+                {std::move(tSelector)},
+                {std::forward<T>(tRules)...}
+            )
+        {}
+        template <class... T, class = CssRule>
+        CssAtNested (std::initializer_list<Text>&& tSelectors, T&& ...tRules) :
+            CssRule(
+                true,
+                PREFIX,
+                {},
+                std::move(tSelectors),
+                {std::forward<T>(tRules)...}
+            )
+        {}
+    };
+
+    struct CssVar : CssRule {
+        CssVar (const char* tName, Text&& tValue) :
+            CssRule(false, tName, std::move(tValue), {}, {})
+        {}
+    };
+
+    namespace exports {
+        template<const char* NAME>
+        using property = CssProperty<NAME>;
+        using rule = CssRule;
+        using styles = std::initializer_list<CssRule>;
+        using prop = CssVar;
+    }
+}}
+
+
+////|         |////
+////|  Names  |////
+////|         |////
+
+
+#define WEBXX_HTML_TAGS(X)\
+    X(a,a,TRANSPARENT)\
+    X(abbr,abbr,0)\
+    X(address,address,CLOSES_P)\
+    X(area,area,VOID_ELEMENT)\
+    X(article,article,CLOSES_P)\
+    X(aside,aside,CLOSES_P)\
+    X(audio,audio,TRANSPARENT)\
+    X(b,b,0)\
+    X(base,base,VOID_ELEMENT)\
+    X(bdi,bdi,0)\
+    X(bdo,bdo,0)\
+    X(blockquote,blockquote,CLOSES_P)\
+    X(body,body,OPTIONAL_END_TAG)\
+    X(br,br,VOID_ELEMENT)\
+    X(button,button,0)\
+    X(canvas,canvas,0)\
+    X(caption,caption,0)\
+    X(cite,cite,0)\
+    X(code,code,0)\
+    X(col,col,VOID_ELEMENT)\
+    X(colgroup,colgroup,0)\
+    X(data,data,0)\
+    X(datalist,datalist,0)\
+    X(dd,dd,0)\
+    X(del,del,TRANSPARENT)\
+    X(details,details,CLOSES_P)\
+    X(dfn,dfn,0)\
+    X(dialog,dialog,CLOSES_P)\
+    X(div,dv,CLOSES_P)\
+    X(dl,dl,CLOSES_P)\
+    X(dt,dt,0)\
+    X(em,em,0)\
+    X(embed,embed,VOID_ELEMENT)\
+    X(fieldset,fieldset,CLOSES_P)\
+    X(figcaption,figcaption,CLOSES_P)\
+    X(figure,figure,CLOSES_P)\
+    X(footer,footer,CLOSES_P)\
+    X(form,form,CLOSES_P)\
+    X(h1,h1,CLOSES_P)\
+    X(h2,h2,CLOSES_P)\
+    X(h3,h3,CLOSES_P)\
+    X(h4,h4,CLOSES_P)\
+    X(h5,h5,CLOSES_P)\
+    X(h6,h6,CLOSES_P)\
+    X(head,head,OPTIONAL_END_TAG)\
+    X(header,header,CLOSES_P)\
+    X(hr,hr,VOID_ELEMENT|CLOSES_P)\
+    X(html,html,OPTIONAL_END_TAG)\
+    X(i,i,0)\
+    X(iframe,iframe,0)\
+    X(img,img,VOID_ELEMENT)\
+    X(input,input,VOID_ELEMENT)\
+    X(ins,ins,TRANSPARENT)\
+    X(kbd,kbd,0)\
+    X(label,label,0)\
+    X(legend,legend,0)\
+    X(li,li,OPTIONAL_END_TAG)\
+    X(link,link,VOID_ELEMENT)\
+    X(main,main,CLOSES_P)\
+    X(map,map,TRANSPARENT)\
+    X(mark,mark,0)\
+    X(math,math,0)\
+    X(menu,menu,CLOSES_P)\
+    X(meta,meta,VOID_ELEMENT)\
+    X(meter,meter,0)\
+    X(nav,nav,CLOSES_P)\
+    X(noscript,noscript,TRANSPARENT)\
+    X(object,object,0)\
+    X(ol,ol,CLOSES_P)\
+    X(optgroup,optgroup,0)\
+    X(option,option,OPTIONAL_END_TAG)\
+    X(output,output,0)\
+    X(p,p,OPTIONAL_END_TAG|CLOSES_P)\
+    X(picture,picture,0)\
+    X(portal,portal,0)\
+    X(pre,pre,CLOSES_P)\
+    X(progress,progress,0)\
+    X(q,q,0)\
+    X(rp,rp,0)\
+    X(rt,rt,0)\
+    X(ruby,ruby,0)\
+    X(s,s,0)\
+    X(samp,samp,0)\
+    X(script,script,RAW_TEXT)\
+    X(section,section,CLOSES_P)\
+    X(select,select,0)\
+    X(slot,slot,0)\
+    X(small,small,0)\
+    X(source,source,VOID_ELEMENT)\
+    X(span,span,0)\
+    X(strong,strong,0)\
+    X(style,style,RAW_TEXT)\
+    X(sub,sub,0)\
+    X(summary,summary,0)\
+    X(sup,sup,0)\
+    X(svg,svg,0)\
+    X(table,table,CLOSES_P)\
+    X(tbody,tbody,OPTIONAL_END_TAG)\
+    X(td,td,OPTIONAL_END_TAG)\
+    X(template,template_,0)\
+    X(textarea,textarea,0)\
+    X(tfoot,tfoot,OPTIONAL_END_TAG)\
+    X(th,th,OPTIONAL_END_TAG)\
+    X(thead,thead,OPTIONAL_END_TAG)\
+    X(time,time,0)\
+    X(title,title,0)\
+    X(tr,tr,OPTIONAL_END_TAG)\
+    X(track,track,VOID_ELEMENT)\
+    X(u,u,0)\
+    X(ul,ul,CLOSES_P)\
+    X(var,var,0)\
+    X(video,video,TRANSPARENT)\
+    X(wbr,wbr,VOID_ELEMENT)
+#define WEBXX_HTML_ATTRS(X)\
+    X(accept,_accept,0)\
+    X(accept-charset,_acceptCharset,0)\
+    X(accesskey,_accesskey,0)\
+    X(action,_action,0)\
+    X(align,_align,0)\
+    X(allow,_allow,0)\
+    X(alt,_alt,0)\
+    X(as,_as,0)\
+    X(async,_async,BOOLEAN_ATTRIBUTE)\
+    X(autocapitalize,_autocapitalize,0)\
+    X(autocomplete,_autocomplete,0)\
+    X(autocorrect,_autocorrect,0)\
+    X(autofill,_autofill,0)\
+    X(autofocus,_autofocus,BOOLEAN_ATTRIBUTE)\
+    X(autoplay,_autoplay,BOOLEAN_ATTRIBUTE)\
+    X(blocking,_blocking,0)\
+    X(buffered,_buffered,0)\
+    X(capture,_capture,0)\
+    X(challenge,_challenge,0)\
+    X(charset,_charset,0)\
+    X(checked,_checked,BOOLEAN_ATTRIBUTE)\
+    X(cite,_cite,0)\
+    X(class,_class,0)\
+    X(code,_code,0)\
+    X(codebase,_codebase,0)\
+    X(cols,_cols,0)\
+    X(colspan,_colspan,0)\
+    X(content,_content,0)\
+    X(contenteditable,_contenteditable,0)\
+    X(contextmenu,_contextmenu,0)\
+    X(controls,_controls,BOOLEAN_ATTRIBUTE)\
+    X(coords,_coords,0)\
+    X(crossorigin,_crossorigin,0)\
+    X(csp,_csp,0)\
+    X(data,_data,0)\
+    X(datetime,_datetime,0)\
+    X(decoding,_decoding,0)\
+    X(default,_default,BOOLEAN_ATTRIBUTE)\
+    X(defer,_defer,BOOLEAN_ATTRIBUTE)\
+    X(dir,_dir,0)\
+    X(dirname,_dirname,0)\
+    X(disabled,_disabled,BOOLEAN_ATTRIBUTE)\
+    X(download,_download,0)\
+    X(draggable,_draggable,0)\
+    X(enctype,_enctype,0)\
+    X(enterkeyhint,_enterkeyhint,0)\
+    X(for,_for,0)\
+    X(form,_form,0)\
+    X(formaction,_formaction,0)\
+    X(formenctype,_formenctype,0)\
+    X(formmethod,_formmethod,0)\
+    X(formnovalidate,_formnovalidate,BOOLEAN_ATTRIBUTE)\
+    X(formtarget,_formtarget,0)\
+    X(headers,_headers,0)\
+    X(height,_height,0)\
+    X(hidden,_hidden,BOOLEAN_ATTRIBUTE)\
+    X(high,_high,0)\
+    X(href,_href,0)\
+    X(hreflang,_hreflang,0)\
+    X(http-equiv,_httpEquiv,0)\
+    X(icon,_icon,0)\
+    X(id,_id,0)\
+    X(importance,_importance,0)\
+    X(integrity,_integrity,0)\
+    X(inputmode,_inputmode,0)\
+    X(ismap,_ismap,BOOLEAN_ATTRIBUTE)\
+    X(itemprop,_itemprop,0)\
+    X(keytype,_keytype,0)\
+    X(kind,_kind,0)\
+    X(label,_label,0)\
+    X(lang,_lang,0)\
+    X(loading,_loading,0)\
+    X(list,_list,0)\
+    X(loop,_loop,BOOLEAN_ATTRIBUTE)\
+    X(low,_low,0)\
+    X(max,_max,0)\
+    X(maxlength,_maxlength,0)\
+    X(minlength,_minlength,0)\
+    X(media,_media,0)\
+    X(method,_method,0)\
+    X(min,_min,0)\
+    X(multiple,_multiple,BOOLEAN_ATTRIBUTE)\
+    X(muted,_muted,BOOLEAN_ATTRIBUTE)\
+    X(name,_name,0)\
+    X(novalidate,_novalidate,BOOLEAN_ATTRIBUTE)\
+    X(open,_open,BOOLEAN_ATTRIBUTE)\
+    X(optimum,_optimum,0)\
+    X(pattern,_pattern,0)\
+    X(ping,_ping,0)\
+    X(placeholder,_placeholder,0)\
+    X(poster,_poster,0)\
+    X(preload,_preload,0)\
+    X(radiogroup,_radiogroup,0)\
+    X(readonly,_readonly,BOOLEAN_ATTRIBUTE)\
+    X(referrerpolicy,_referrerpolicy,0)\
+    X(rel,_rel,0)\
+    X(required,_required,BOOLEAN_ATTRIBUTE)\
+    X(reversed,_reversed,BOOLEAN_ATTRIBUTE)\
+    X(role,_role,0)\
+    X(rows,_rows,0)\
+    X(rowspan,_rowspan,0)\
+    X(sandbox,_sandbox,0)\
+    X(scope,_scope,0)\
+    X(selected,_selected,BOOLEAN_ATTRIBUTE)\
+    X(shape,_shape,0)\
+    X(size,_size,0)\
+    X(sizes,_sizes,0)\
+    X(slot,_slot,0)\
+    X(span,_span,0)\
+    X(spellcheck,_spellcheck,0)\
+    X(src,_src,0)\
+    X(srcdoc,_srcdoc,0)\
+    X(srclang,_srclang,0)\
+    X(srcset,_srcset,0)\
+    X(start,_start,0)\
+    X(step,_step,0)\
+    X(style,_style,0)\
+    X(tabindex,_tabindex,0)\
+    X(target,_target,0)\
+    X(title,_title,0)\
+    X(translate,_translate,0)\
+    X(type,_type,0)\
+    X(usemap,_usemap,0)\
+    X(value,_value,0)\
+    X(width,_width,0)\
+    X(wrap,_wrap,0)
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    inline constexpr char doctype[] = "<!doctype html>";
+
+    typedef std::uint16_t NameId;
+
+    enum NameFlags : std::uint8_t {
+        VOID_ELEMENT = 1,       // Has no closing tag.
+        RAW_TEXT = 2,           // Content is not HTML, e.g. <script>.
+        BOOLEAN_ATTRIBUTE = 4,  // Present or absent, without a value.
+        VERBATIM = 8,           // Name is rendered as-is, e.g. the doctype.
+        OPTIONAL_END_TAG = 16,  // End tag can be left out before certain elements, e.g. </li>.
+        CLOSES_P = 32,          // Implies the end of an open <p>, so its </p> can be left out.
+        TRANSPARENT = 64,       // A <p> ending with it can't leave out its </p>.
+    };
+
+    struct NameInfo {
+        std::string_view name;
+        std::uint8_t flags;
+    };
+
+#define WEBXX_NAME_ID(NAME,ID,FLAGS) ID,
+#define WEBXX_NAME_INFO(NAME,ID,FLAGS) {#NAME, FLAGS},
+    struct HtmlTag {
+        enum : NameId {
+            NONE,
+            DOCTYPE,
+            WEBXX_HTML_TAGS(WEBXX_NAME_ID)
+            CUSTOM,
+        };
+        static constexpr NameInfo names[] = {
+            {none, 0},
+            {doctype, VERBATIM},
+            WEBXX_HTML_TAGS(WEBXX_NAME_INFO)
+        };
+    };
+
+    struct HtmlAttr {
+        enum : NameId {
+            NONE,
+            WEBXX_HTML_ATTRS(WEBXX_NAME_ID)
+            CUSTOM,
+        };
+        static constexpr NameInfo names[] = {
+            {none, 0},
+            WEBXX_HTML_ATTRS(WEBXX_NAME_INFO)
+        };
+    };
+#undef WEBXX_NAME_ID
+#undef WEBXX_NAME_INFO
+
+    static_assert(sizeof(HtmlTag::names) / sizeof(NameInfo) == HtmlTag::CUSTOM);
+    static_assert(sizeof(HtmlAttr::names) / sizeof(NameInfo) == HtmlAttr::CUSTOM);
+
+    // Names outside the standard tables (from el<> & attr<>) are given IDs
+    // after CUSTOM the first time they are used:
+    template<class KIND>
+    struct CustomNames {
+        static inline NameInfo names[WEBXX_CUSTOM_NAME_CAPACITY]{};
+        static inline std::atomic<std::size_t> count{0};
+
+        static NameId add (const std::string_view name, const std::uint8_t flags = 0) {
+            const std::size_t index = count.fetch_add(1);
+            if (index >= WEBXX_CUSTOM_NAME_CAPACITY) {
+                throw std::length_error("Too many custom names, increase WEBXX_CUSTOM_NAME_CAPACITY");
+            }
+            names[index] = {name, flags};
+            return static_cast<NameId>(KIND::CUSTOM + index);
+        }
+    };
+
+    template<class KIND>
+    inline const NameInfo& nameInfo (const NameId id) {
+        return id < KIND::CUSTOM
+            ? KIND::names[id]
+            : CustomNames<KIND>::names[id - KIND::CUSTOM];
+    }
+
+    template<NameId ID>
+    struct StandardName {
+        static constexpr NameId id () {
+            return ID;
+        }
+    };
+
+    template<class KIND, const char* NAME, std::uint8_t FLAGS = 0>
+    struct CustomName {
+        static NameId id () {
+            static const NameId customId = CustomNames<KIND>::add(NAME, FLAGS);
+            return customId;
+        }
+    };
+}}
+
+
+////|        |////
+////|  HTML  |////
+////|        |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    typedef const char* HtmlAttributeName;
+
+    typedef SmallVector<Text, 1> HtmlAttributeValues;
+
+    struct HtmlAttribute {
+        struct Data {
+            NameId id;
+            HtmlAttributeValues values;
+
+            WEBXX_MOVE_ONLY_CONSTRUCTORS(Data)
+
+            Data (
+                NameId tId = HtmlAttr::NONE,
+                HtmlAttributeValues&& tValues = {}
+            ) :
+                id{tId},
+                values{std::move(tValues)}
+            {}
+
+            const NameInfo& info () const {
+                return nameInfo<HtmlAttr>(id);
+            }
+            std::string_view name () const {
+                return info().name;
+            }
+        };
+
+        mutable Data data;
+
+        HtmlAttribute (HtmlAttribute&&) = default;              // move construct
+        HtmlAttribute& operator= (HtmlAttribute&&) = default;   // move assign
+        HtmlAttribute (const HtmlAttribute& other) :            // copy construct
+            data {std::move(other.data)}
+        {}
+        HtmlAttribute& operator= (HtmlAttribute& other) {       // copy assign
+            this->data = std::move(other.data);
+            return *this;
+        }
+
+        HtmlAttribute (
+            NameId tId = HtmlAttr::NONE,
+            HtmlAttributeValues&& tValues = {}
+        ) : data {
+            tId,
+            std::move(tValues)
+        } {}
+    };
+
+    template<class NAME>
+    struct HtmlAttributeDefined : public HtmlAttribute {
+        HtmlAttributeDefined () :
+            HtmlAttribute(NAME::id(), {})
+        {}
+        HtmlAttributeDefined (std::vector<Text>&& values) :
+            HtmlAttribute(NAME::id(), std::move(values))
+        {}
+        HtmlAttributeDefined (std::initializer_list<Text>&& values) :
+            HtmlAttribute(NAME::id(), std::move(values))
+        {}
+        template <class... T, class = Text>
+        HtmlAttributeDefined (T&& ...values) :
+            HtmlAttribute(NAME::id(), {std::forward<T>(values)...})
+        {}
+    };
+
+    typedef const char* TagName;
+
+    enum CollectionTarget : std::uint8_t {
+        NONE = 0,
+        CSS = 1,
+        SCRIPT = 2,
+        PLACEHOLDER = 3,
+        VARIABLE = 4,
+        HEAD = 5,
+        NAMED = 6,  // And above: user-defined, one for each collection name.
+    };
+
+    inline CollectionTarget addNamedCollection () {
+        static std::atomic<std::size_t> count{0};
+        const std::size_t index = count.fetch_add(1);
+        if (index > std::size_t{UINT8_MAX - NAMED}) {
+            throw std::length_error("webxx: too many named collections");
+        }
+        return static_cast<CollectionTarget>(NAMED + index);
+    }
+
+    // User-defined collections (from collection<> & collectionTarget<>) are
+    // given targets after NAMED the first time they are used:
+    template<const char* NAME>
+    struct CollectionName {
+        static CollectionTarget target () {
+            static const CollectionTarget namedTarget = addNamedCollection();
+            return namedTarget;
+        }
+    };
+
+    struct HtmlNodeOptions {
+        NameId tag;
+        CollectionTarget gathersCollection;
+        CollectionTarget emitsCollection;
+
+        HtmlNodeOptions (HtmlNodeOptions&&) = default;
+        HtmlNodeOptions& operator= (HtmlNodeOptions&& other) = default;
+        HtmlNodeOptions (const HtmlNodeOptions&) = delete;
+        HtmlNodeOptions& operator= (const HtmlNodeOptions&) = delete;
+
+        HtmlNodeOptions () :
+            tag{HtmlTag::NONE},
+            gathersCollection{NONE},
+            emitsCollection{NONE}
+        {}
+
+        HtmlNodeOptions (
+            NameId tTag,
+            CollectionTarget tGathersCollection,
+            CollectionTarget tEmitsCollection
+        ) :
+            tag{tTag},
+            gathersCollection{tGathersCollection},
+            emitsCollection{tEmitsCollection}
+        {}
+
+        const NameInfo& info () const {
+            return nameInfo<HtmlTag>(tag);
+        }
+        std::string_view tagName () const {
+            const NameInfo& tagInfo = info();
+            return tagInfo.flags & VERBATIM ? std::string_view{} : tagInfo.name;
+        }
+        std::string_view prefix () const {
+            const NameInfo& tagInfo = info();
+            return tagInfo.flags & VERBATIM ? tagInfo.name : std::string_view{};
+        }
+        bool selfClosing () const {
+            return info().flags & VOID_ELEMENT;
+        }
+    };
+
+    struct HtmlNode;
+
+    // Not a SmallVector: an inline attribute (88 bytes) would grow every node,
+    // most of which are text without attributes, from 128 to 208 bytes:
+    typedef std::vector<HtmlAttribute> HtmlAttributes;
+
+    typedef std::string_view ComponentName;
+    typedef std::size_t ComponentTypeId;
+    typedef std::function<HtmlNode()> ContentProducer;
+
+    // Produces the next node of a lazily rendered range, or nothing at its end:
+    typedef std::function<std::optional<HtmlNode>()> ContentCursor;
+
+    struct ContentGenerator {
+        std::function<ContentCursor()> cursor;
+        bool multiPass; // Whether more than one cursor can be taken.
+        std::size_t batchSize; // Nodes to render between flushes (0 = never flush).
+    };
+
+    // The rendered output of a subtree, for each placeholder locale (as
+    // identified by the render options), whether minified, & component scope
+    // it is rendered in:
+    class FragmentCache {
+        struct Entry {
+            std::size_t locale;
+            bool minified;
+            ComponentTypeId component;
+            std::shared_ptr<const std::string> rendered;
+        };
+
+        mutable std::shared_mutex mutex;
+        std::vector<Entry> entries;
+        std::uint64_t generation;
+        std::atomic<bool> collects;
+
+        public:
+        FragmentCache () : mutex{}, entries{}, generation{1}, collects{false} {}
+
+        // Subtrees that contribute CSS or head elements can't be cached, as
+        // those must be collected wherever the subtree is rendered:
+        bool cacheable () const {
+            return !collects.load(std::memory_order_relaxed);
+        }
+
+        void uncacheable () {
+            collects.store(true, std::memory_order_relaxed);
+        }
+
+        // The output if found, otherwise the generation to store it with:
+        std::shared_ptr<const std::string> find (std::size_t locale, bool minified, ComponentTypeId component, std::uint64_t& tGeneration) const {
+            std::shared_lock lock{mutex};
+            for (const auto& entry : entries) {
+                if (entry.locale == locale && entry.minified == minified && entry.component == component) {
+                    return entry.rendered;
+                }
+            }
+            tGeneration = generation;
+            return nullptr;
+        }
+
+        // Output rendered before the cache was last invalidated is dropped:
+        void store (std::size_t locale, bool minified, ComponentTypeId component, std::uint64_t tGeneration, std::string&& rendered) {
+            auto stored = std::make_shared<const std::string>(std::move(rendered));
+            std::unique_lock lock{mutex};
+            if (tGeneration != generation) {
+                return;
+            }
+            for (auto& entry : entries) {
+                if (entry.locale == locale && entry.minified == minified && entry.component == component) {
+                    entry.rendered = std::move(stored);
+                    return;
+                }
+            }
+            entries.push_back({locale, minified, component, std::move(stored)});
+        }
+
+        // Forget everything rendered, e.g. once a catalog has been reloaded:
+        void invalidate () {
+            std::unique_lock lock{mutex};
+            entries.clear();
+            ++generation;
+            collects.store(false, std::memory_order_relaxed);
+        }
+    };
+
+    struct CachedFragment {
+        FragmentCache* cache;
+        // Set by the collector, to output from the cache, or to store what is rendered:
+        std::shared_ptr<const std::string> rendered;
+        std::uint64_t generation;
+    };
+
+    // Fields that few nodes use, kept out of line so that ordinary nodes stay small:
+    struct HtmlNodeExtra {
+        ContentProducer contentLazy;
+        std::vector<CssRule> css;
+        ComponentTypeId componentTypeId;
+        ContentGenerator contentGenerator;
+        std::unique_ptr<CachedFragment> cachedFragment;
+    };
+
+    struct HtmlNode {
+        struct Data {
+            HtmlNodeOptions options;
+            HtmlAttributes attributes;
+            std::vector<HtmlNode> children;
+            Text content;
+            std::unique_ptr<HtmlNodeExtra> extra;
+
+            WEBXX_MOVE_ONLY_CONSTRUCTORS(Data)
+
+            Data (
+                HtmlNodeOptions&& tOptions = {HtmlTag::NONE, NONE, NONE},
+                HtmlAttributes&& tAttributes = {},
+                std::vector<HtmlNode>&& tChildren = {},
+                Text&& tContent = {},
+                ContentProducer&& tContentLazy = {},
+                std::vector<CssRule>&& tCss = {},
+                ComponentTypeId tComponentTypeId = 0
+            ) :
+                options{std::move(tOptions)},
+                attributes{std::move(tAttributes)},
+                children{std::move(tChildren)},
+                content{std::move(tContent)},
+                extra{}
+            {
+                if (tContentLazy || !tCss.empty() || tComponentTypeId) {
+                    extra.reset(new HtmlNodeExtra{
+                        std::move(tContentLazy),
+                        std::move(tCss),
+                        tComponentTypeId,
+                        {},
+                        {},
+                    });
+                }
+            }
+
+            ComponentTypeId componentTypeId () const {
+                return extra ? extra->componentTypeId : 0;
+            }
+        };
+
+        mutable Data data;
+
+        HtmlNode (HtmlNode&&) = default;            // move construct
+        HtmlNode& operator= (HtmlNode&&) = default; // move assign
+        HtmlNode (const HtmlNode& other) : data {   // copy construct
+            std::move(other.data)
+        } {}
+        HtmlNode& operator= (HtmlNode& other) {     // copy assign
+            this->data = std::move(other.data);
+            return *this;
+        }
+
+        HtmlNode (Placeholder&& tPlaceholder) : data {
+            {HtmlTag::NONE, PLACEHOLDER, NONE},
+            {},
+            {},
+            std::move(tPlaceholder),
+        } {}
+        HtmlNode (const PlaceholderKey& tKey) : data {
+            {HtmlTag::NONE, PLACEHOLDER, NONE},
+            {},
+            {},
+            tKey,
+        } {}
+        HtmlNode (ContentProducer&& tNodeProducer) : data {
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {},
+            {},
+            std::move(tNodeProducer),
+        } {}
+        HtmlNode (std::string&& tContent) : data {
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {},
+            std::move(tContent),
+        } {}
+        HtmlNode (const char* tContent) : data {
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {},
+            tContent,
+        } {}
+        HtmlNode (const std::string& tContent) : data {
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {},
+            tContent,
+        } {}
+        HtmlNode (const std::string_view tContent) : data {
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {},
+            std::move(tContent),
+        } {}
+
+        HtmlNode (
+            HtmlNodeOptions&& tOptions = {HtmlTag::NONE, NONE, NONE},
+            HtmlAttributes&& tAttributes = {},
+            std::vector<HtmlNode>&& tChildren = {},
+            Text&& tContent = {},
+            ContentProducer&& tContentLazy = {},
+            std::vector<CssRule>&& tCss = {},
+            ComponentTypeId tComponentTypeId = 0
+        ) : data {
+            std::move(tOptions),
+            std::move(tAttributes),
+            std::move(tChildren),
+            std::move(tContent),
+            std::move(tContentLazy),
+            std::move(tCss),
+            tComponentTypeId
+        } {}
+    };
+
+    template<
+        class TAG = StandardName<HtmlTag::NONE>,
+        CollectionTarget COLLECTS = NONE,
+        CollectionTarget COLLECTION = NONE
+    >
+    struct HtmlNodeDefined : public HtmlNode {
+        HtmlNodeDefined () :
+            HtmlNode(
+                HtmlNodeOptions{TAG::id(), COLLECTS, COLLECTION}
+            )
+        {}
+        HtmlNodeDefined (std::vector<HtmlNode>&& tChildren) :
+            HtmlNode(
+                {TAG::id(), COLLECTS, COLLECTION},
+                {},
+                std::move(tChildren)
+            )
+        {}
+        HtmlNodeDefined (std::initializer_list<HtmlNode>&& tChildren) :
+            HtmlNode(
+                {TAG::id(), COLLECTS, COLLECTION},
+                {},
+                std::move(tChildren)
+            )
+        {}
+        template <class... T, class = HtmlNode>
+        HtmlNodeDefined (std::initializer_list<HtmlAttribute>&& tAttributes, T&& ...tChildren) :
+            HtmlNode(
+                {TAG::id(), COLLECTS, COLLECTION},
+                std::move(tAttributes),
+                {std::forward<T>(tChildren)...}
+            )
+        {}
+        template <class... T, class = HtmlNode>
+        HtmlNodeDefined (std::vector<HtmlAttribute>&& tAttributes, T&& ...tChildren) :
+            HtmlNode(
+                {TAG::id(), COLLECTS, COLLECTION},
+                std::move(tAttributes),
+                {std::forward<T>(tChildren)...}
+            )
+        {}
+    };
+
+    struct HtmlStyleNode : HtmlNode {
+        HtmlStyleNode () :
+            HtmlNode(HtmlNodeOptions{HtmlTag::style, NONE, NONE})
+        {}
+        HtmlStyleNode (std::initializer_list<CssRule>&& tCss) :
+            HtmlNode({HtmlTag::style, NONE, NONE}, {}, {}, {}, {}, std::move(tCss))
+        {}
+        template<typename ...T>
+        HtmlStyleNode (std::initializer_list<HtmlAttribute>&& tAttributes, T&& ...tCss) :
+            HtmlNode({HtmlTag::style, NONE, NONE}, std::move(tAttributes), {}, {}, {}, {std::forward<T>(tCss)...})
+        {}
+        // HtmlStyleNode (std::initializer_list<HtmlAttributeProxy>&& tAttrs, std::initializer_list<CssRuleProxy>&& tCss) :
+    };
+
+    // Renders one node at a time from a generator, without holding them all:
+    struct HtmlGeneratedNode : HtmlNode {
+        HtmlGeneratedNode (ContentGenerator&& tGenerator) : HtmlNode() {
+            data.extra.reset(new HtmlNodeExtra{{}, {}, 0, std::move(tGenerator), {}});
+        }
+    };
+
+    // Renders the produced subtree once for each placeholder locale, after
+    // which its output is taken from the cache (without producing it):
+    struct HtmlCachedNode : HtmlNode {
+        HtmlCachedNode (FragmentCache& tCache, ContentProducer&& tProducer) : HtmlNode() {
+            data.extra.reset(new HtmlNodeExtra{
+                std::move(tProducer),
+                {},
+                0,
+                {},
+                std::unique_ptr<CachedFragment>{new CachedFragment{&tCache, {}, 0}},
+            });
+        }
+    };
+
+    struct HtmlStyleCollectionNode : HtmlNode {
+        HtmlStyleCollectionNode () :
+            HtmlNode(HtmlNodeOptions{HtmlTag::NONE, NONE, CSS})
+        {}
+        HtmlStyleCollectionNode (std::initializer_list<CssRule> &&tCss) :
+            HtmlNode({HtmlTag::NONE, NONE, CSS}, {}, {}, {}, {}, std::move(tCss))
+        {}
+    };
+
+    // CSS custom properties (e.g. theme variables), rendered in one :root
+    // rule wherever they are collected:
+    struct HtmlVariableCollectionNode : HtmlNode {
+        HtmlVariableCollectionNode () :
+            HtmlNode(HtmlNodeOptions{HtmlTag::NONE, NONE, VARIABLE})
+        {}
+        HtmlVariableCollectionNode (std::initializer_list<CssRule> &&tVariables) :
+            HtmlNode({HtmlTag::NONE, NONE, VARIABLE}, {}, {}, {}, {}, std::move(tVariables))
+        {}
+    };
+
+    typedef HtmlNodeDefined<StandardName<HtmlTag::NONE>, NONE, HEAD> HtmlHeadCollectionNode;
+
+    // Either the nodes of a named collection, or the target they are rendered at:
+    template<class NAME, bool IS_TARGET>
+    struct HtmlNamedCollectionNode : HtmlNode {
+        HtmlNamedCollectionNode () :
+            HtmlNode(options())
+        {}
+        HtmlNamedCollectionNode (std::initializer_list<HtmlNode>&& tChildren) :
+            HtmlNode(options(), {}, std::move(tChildren))
+        {}
+
+        private:
+
+        static HtmlNodeOptions options () {
+            if (IS_TARGET) {
+                return {HtmlTag::NONE, NAME::target(), NONE};
+            }
+            return {HtmlTag::NONE, NONE, NAME::target()};
+        }
+    };
+
+    // The scripts of a component, rendered as one <script> wherever they are collected:
+    struct HtmlScriptCollectionNode : HtmlNode {
+        HtmlScriptCollectionNode () :
+            HtmlNode(HtmlNodeOptions{HtmlTag::NONE, NONE, SCRIPT})
+        {}
+        HtmlScriptCollectionNode (std::initializer_list<HtmlNode>&& tScripts) :
+            HtmlNode(
+                {HtmlTag::NONE, NONE, SCRIPT},
+                {},
+                {HtmlNodeDefined<StandardName<HtmlTag::script>>{std::move(tScripts)}}
+            )
+        {}
+    };
+
+    namespace exports {
+        // HTML extensibility:
+        template<TagName TAG>
+        using el = HtmlNodeDefined<CustomName<HtmlTag, TAG>>;
+        template<HtmlAttributeName NAME>
+        using attr = HtmlAttributeDefined<CustomName<HtmlAttr, NAME>>;
+
+        using node = HtmlNode;
+        using nodes = std::vector<HtmlNode>;
+        using children = std::initializer_list<HtmlNode>;
+        using attrs = std::initializer_list<HtmlAttribute>;
+
+        // HTML special purpose nodes:
+        using doc = HtmlNodeDefined<StandardName<HtmlTag::DOCTYPE>>;
+        using text = HtmlNodeDefined<>;
+        using fragment = HtmlNodeDefined<>;
+        using lazy = ContentProducer;
+        using cached = HtmlCachedNode;
+        using fragmentCache = FragmentCache;
+        using style = HtmlStyleNode;
+        using styleTarget = HtmlNodeDefined<StandardName<HtmlTag::style>, CSS, NONE>;
+        using headTarget = HtmlNodeDefined<StandardName<HtmlTag::NONE>, HEAD, NONE>;
+        using scriptTarget = HtmlNodeDefined<StandardName<HtmlTag::NONE>, SCRIPT, NONE>;
+        // Head elements from outside of a component:
+        using headElements = HtmlHeadCollectionNode;
+        using variables = HtmlVariableCollectionNode;
+        using variableTarget = HtmlNodeDefined<StandardName<HtmlTag::style>, VARIABLE, NONE>;
+
+        // User-defined collections, whose nodes are rendered once per component
+        // type wherever the target of the same name appears:
+        template<const char* NAME>
+        using collection = HtmlNamedCollectionNode<CollectionName<NAME>, false>;
+        template<const char* NAME>
+        using collectionTarget = HtmlNamedCollectionNode<CollectionName<NAME>, true>;
+    }
+}}
+
+
+////|             |////
+////|  Component  |////
+////|             |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    struct ComponentBase : public HtmlNode {
+        ComponentBase (
+            const ComponentTypeId tTypeId,
+            HtmlStyleCollectionNode&& tCss,
+            HtmlNode&& tRoot,
+            HtmlHeadCollectionNode&& tHead
+        ) : HtmlNode(
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {
+                std::move(tRoot),
+                std::move(tCss),
+                std::move(tHead),
+            },
+            {},
+            {},
+            {},
+            tTypeId
+        ) {}
+        ComponentBase (
+            const ComponentTypeId tTypeId,
+            HtmlStyleCollectionNode&& tCss,
+            HtmlNode&& tRoot,
+            HtmlHeadCollectionNode&& tHead,
+            HtmlScriptCollectionNode&& tScripts
+        ) : HtmlNode(
+            {HtmlTag::NONE, NONE, NONE},
+            {},
+            {
+                std::move(tRoot),
+                std::move(tCss),
+                std::move(tHead),
+                std::move(tScripts),
+            },
+            {},
+            {},
+            {},
+            tTypeId
+        ) {}
+    };
+
+    template <typename T>
+    constexpr size_t ctHash () {
+        size_t hash{0};
+        for (const char& c : WEBXX_FN_SIG) {
+            (hash ^= static_cast<size_t>(c)) <<= 1;
+        }
+        return hash;
+    }
+
+    template <typename T>
+    inline constexpr size_t compileTimeTypeId = ctHash<T>();
+
+    // Extracts a readable name for T from the function signature:
+    template <typename T>
+    constexpr std::string_view typeName () {
+        constexpr std::string_view signature{WEBXX_FN_SIG};
+#ifdef _MSC_VER
+        constexpr std::size_t start = signature.find("typeName<") + 9;
+        constexpr std::size_t end = signature.rfind(">(");
+#else
+        constexpr std::size_t start = signature.find("T = ") + 4;
+        constexpr std::size_t end = signature.find_first_of(";]", start);
+#endif
+        return signature.substr(start, end - start);
+    }
+
+#ifdef WEBXX_INSTRUMENT
+    typedef std::unordered_map<ComponentTypeId, std::string_view> ComponentNames;
+
+    inline std::mutex& componentNamesMutex () {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    inline ComponentNames& componentNames () {
+        static ComponentNames names;
+        return names;
+    }
+
+    inline bool registerComponentName (ComponentTypeId id, std::string_view name) {
+        std::lock_guard<std::mutex> lock(componentNamesMutex());
+        componentNames().emplace(id, name);
+        return true;
+    }
+
+    inline std::string_view componentTypeName (ComponentTypeId id) {
+        std::lock_guard<std::mutex> lock(componentNamesMutex());
+        auto found = componentNames().find(id);
+        return found == componentNames().end() ? std::string_view{} : found->second;
+    }
+
+    template <class T, size_t K>
+    inline const bool componentNameRegistered = registerComponentName(K, typeName<T>());
+#endif
+
+#ifdef WEBXX_INSTRUMENT
+#define WEBXX_COMPONENT_REGISTER (void) componentNameRegistered<T, K>;
+#else
+#define WEBXX_COMPONENT_REGISTER
+#endif
+
+    template <class T, size_t K = compileTimeTypeId<T>>
+    struct Component : public ComponentBase {
+        constexpr Component (
+            HtmlNode
+            && tRootNode
+        ) : ComponentBase(
+            K,
+            {},
+            std::move(tRootNode),
+            {}
+        ) { WEBXX_COMPONENT_REGISTER }
+        constexpr Component (
+            HtmlStyleCollectionNode&& tCss,
+            HtmlNode&& tRootNode
+        ) : ComponentBase(
+            K,
+            std::move(tCss),
+            std::move(tRootNode),
+            {}
+        ) { WEBXX_COMPONENT_REGISTER }
+        constexpr Component (
+            HtmlStyleCollectionNode&& tCss,
+            HtmlNode&& tRootNode,
+            HtmlHeadCollectionNode&& tHeadNode
+        ) : ComponentBase(
+            K,
+            std::move(tCss),
+            std::move(tRootNode),
+            std::move(tHeadNode)
+        ) { WEBXX_COMPONENT_REGISTER }
+        constexpr Component (
+            HtmlStyleCollectionNode&& tCss,
+            HtmlNode&& tRootNode,
+            HtmlHeadCollectionNode&& tHeadNode,
+            HtmlScriptCollectionNode&& tScriptsNode
+        ) : ComponentBase(
+            K,
+            std::move(tCss),
+            std::move(tRootNode),
+            std::move(tHeadNode),
+            std::move(tScriptsNode)
+        ) { WEBXX_COMPONENT_REGISTER }
+    };
+
+#undef WEBXX_COMPONENT_REGISTER
+
+    namespace exports {
+        template <class T>
+        using component = Component<T>;
+    }
+}}
+
+
+////|           |////
+////|  Hashing  |////
+////|           |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    // Streaming XXH64 (https://github.com/Cyan4973/xxHash), used to digest
+    // rendered output as it is produced, e.g. to derive an ETag:
+    class ContentHash {
+        public:
+
+        ContentHash (std::uint64_t tSeed = 0) :
+            seed{tSeed},
+            lanes{
+                tSeed + prime1 + prime2,
+                tSeed + prime2,
+                tSeed,
+                tSeed - prime1,
+            },
+            stripe{},
+            stripeSize{0},
+            totalSize{0}
+        {}
+
+        void update (const std::string_view& data) {
+            const unsigned char* in = reinterpret_cast<const unsigned char*>(data.data());
+            std::size_t remaining = data.size();
+            totalSize += remaining;
+
+            if (stripeSize) {
+                // Top up a partially filled stripe first:
+                const std::size_t take = std::min(remaining, stripeLength - stripeSize);
+                std::memcpy(stripe + stripeSize, in, take);
+                stripeSize += take;
+                in += take;
+                remaining -= take;
+                if (stripeSize < stripeLength) {
+                    return;
+                }
+                consume(stripe);
+                stripeSize = 0;
+            }
+
+            while (remaining >= stripeLength) {
+                consume(in);
+                in += stripeLength;
+                remaining -= stripeLength;
+            }
+
+            if (remaining) {
+                std::memcpy(stripe, in, remaining);
+                stripeSize = remaining;
+            }
+        }
+
+        std::uint64_t digest () const {
+            std::uint64_t hash;
+            if (totalSize >= stripeLength) {
+                hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+                for (const std::uint64_t lane : lanes) {
+                    hash = (hash ^ round(0, lane)) * prime1 + prime4;
+                }
+            } else {
+                hash = seed + prime5;
+            }
+            hash += totalSize;
+
+            const unsigned char* in = stripe;
+            std::size_t remaining = stripeSize;
+            while (remaining >= 8) {
+                hash = rotl(hash ^ round(0, read64(in)), 27) * prime1 + prime4;
+                in += 8;
+                remaining -= 8;
+            }
+            if (remaining >= 4) {
+                hash = rotl(hash ^ (read32(in) * prime1), 23) * prime2 + prime3;
+                in += 4;
+                remaining -= 4;
+            }
+            while (remaining) {
+                hash = rotl(hash ^ (*in * prime5), 11) * prime1;
+                ++in;
+                --remaining;
+            }
+
+            hash ^= hash >> 33;
+            hash *= prime2;
+            hash ^= hash >> 29;
+            hash *= prime3;
+            hash ^= hash >> 32;
+            return hash;
+        }
+
+        // A strong HTTP entity tag for the digest (including quotes):
+        std::string etag () const {
+            constexpr char hex[] = "0123456789abcdef";
+            std::string tag(18, '"');
+            std::uint64_t hash = digest();
+            for (std::size_t i = 16; i > 0; --i) {
+                tag[i] = hex[hash & 0xf];
+                hash >>= 4;
+            }
+            return tag;
+        }
+
+        private:
+
+        static constexpr std::uint64_t prime1{11400714785074694791ULL};
+        static constexpr std::uint64_t prime2{14029467366897019727ULL};
+        static constexpr std::uint64_t prime3{1609587929392839161ULL};
+        static constexpr std::uint64_t prime4{9650029242287828579ULL};
+        static constexpr std::uint64_t prime5{2870177450012600261ULL};
+        static constexpr std::size_t stripeLength{32};
+
+        std::uint64_t seed;
+        std::uint64_t lanes[4];
+        unsigned char stripe[stripeLength];
+        std::size_t stripeSize;
+        std::uint64_t totalSize;
+
+        static constexpr std::uint64_t rotl (std::uint64_t value, int bits) {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        static constexpr std::uint64_t round (std::uint64_t acc, std::uint64_t input) {
+            return rotl(acc + input * prime2, 31) * prime1;
+        }
+
+        static std::uint64_t read64 (const unsigned char* in) {
+            return read32(in) | (read32(in + 4) << 32);
+        }
+
+        static std::uint64_t read32 (const unsigned char* in) {
+            return static_cast<std::uint64_t>(in[0])
+                | (static_cast<std::uint64_t>(in[1]) << 8)
+                | (static_cast<std::uint64_t>(in[2]) << 16)
+                | (static_cast<std::uint64_t>(in[3]) << 24);
+        }
+
+        void consume (const unsigned char* in) {
+            for (std::size_t lane = 0; lane < 4; ++lane) {
+                lanes[lane] = round(lanes[lane], read64(in + lane * 8));
+            }
+        }
+    };
+
+    namespace exports {
+        using contentHash = ContentHash;
+    }
+}}
+
+
+////|                   |////
+////|  Instrumentation  |////
+////|                   |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    class RenderStats;
+
+#ifdef WEBXX_INSTRUMENT
+    struct ComponentReport {
+        std::string_view name;
+        std::size_t renders{0};
+        std::chrono::nanoseconds time{0};
+    };
+
+    struct RenderReport {
+        std::size_t nodes{0};
+        std::size_t bytes{0};
+        std::size_t sinkCalls{0};
+        std::size_t lazies{0};
+        std::chrono::nanoseconds lazyTime{0};
+        std::size_t collectedCss{0};
+        std::size_t collectedHeads{0};
+        std::unordered_map<ComponentTypeId, ComponentReport> components{};
+    };
+
+    // Optional hooks, invoked in addition to the aggregation into a report:
+    struct RenderObserver {
+        std::function<void(ComponentTypeId, std::string_view)> onComponentEnter{};
+        std::function<void(ComponentTypeId, std::string_view)> onComponentExit{};
+        std::function<void()> onLazyStart{};
+        std::function<void()> onLazyStop{};
+        std::function<void(const std::string_view&)> onSinkFlush{};
+    };
+
+    class RenderStats {
+        typedef std::chrono::steady_clock Clock;
+
+        struct Entered {
+            ComponentTypeId id;
+            Clock::time_point start;
+        };
+
+        std::vector<Entered> entered{};
+        Clock::time_point lazyStarted{};
+
+        public:
+
+        RenderReport report{};
+        RenderObserver observer{};
+
+        void node () {
+            ++report.nodes;
+        }
+
+        void componentEnter (ComponentTypeId id) {
+            if (!id) {
+                return;
+            }
+            auto& component = report.components[id];
+            if (component.name.empty()) {
+                component.name = componentTypeName(id);
+            }
+            ++component.renders;
+            if (observer.onComponentEnter) {
+                observer.onComponentEnter(id, component.name);
+            }
+            entered.push_back({id, Clock::now()});
+        }
+
+        void componentExit (ComponentTypeId id) {
+            if (!id || entered.empty()) {
+                return;
+            }
+            auto& component = report.components[id];
+            component.time += Clock::now() - entered.back().start;
+            entered.pop_back();
+            if (observer.onComponentExit) {
+                observer.onComponentExit(id, component.name);
+            }
+        }
+
+        void lazyStart () {
+            ++report.lazies;
+            if (observer.onLazyStart) {
+                observer.onLazyStart();
+            }
+            lazyStarted = Clock::now();
+        }
+
+        void lazyStop () {
+            report.lazyTime += Clock::now() - lazyStarted;
+            if (observer.onLazyStop) {
+                observer.onLazyStop();
+            }
+        }
+
+        void sinkFlush (const std::string_view& data) {
+            ++report.sinkCalls;
+            report.bytes += data.size();
+            if (observer.onSinkFlush) {
+                observer.onSinkFlush(data);
+            }
+        }
+
+        void collected (std::size_t css, std::size_t heads) {
+            report.collectedCss += css;
+            report.collectedHeads += heads;
+        }
+    };
+
+    namespace exports {
+        using renderStats = RenderStats;
+        using renderReport = RenderReport;
+        using renderObserver = RenderObserver;
+    }
+#endif
+}}
+
+
+////|             |////
+////|  Rendering  |////
+////|             |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    inline constexpr char componentScopePrefix[] = "data-c";
+
+    struct CollectedCss {
+        const ComponentTypeId componentTypeId;
+        const std::vector<CssRule>& css;
+
+        bool operator == (const CollectedCss &other) const noexcept {
+            return (other.componentTypeId == componentTypeId);
+        }
+    };
+
+    struct CollectedHtml {
+        const ComponentTypeId componentTypeId;
+        const std::vector<HtmlNode>& nodes;
+        // Of the nodes' content, for those outside of any component:
+        const std::uint64_t hash;
+    };
+}}
+
+template<>
+struct std::hash<Webxx::internal::CollectedCss> {
+    std::size_t operator() (const Webxx::internal::CollectedCss& collectedCss) const noexcept {
+        return collectedCss.componentTypeId;
+    }
+};
+
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+    typedef std::function<void(const std::string_view&, std::string&)> RenderReceiverFn;
+    inline constexpr std::size_t renderBufferDefaultSize{16 * 1024};
+
+    inline void renderToInternalBuffer (const std::string_view& data, std::string& buffer) {
+        buffer.append(data);
+    }
+
+    inline void renderToNowhere (const std::string_view&, std::string&) {}
+
+    // Called at flush points (e.g. between batches of streamed rows), with the render buffer:
+    typedef std::function<void(std::string&)> RenderFlushFn;
+
+    enum class SinkStatus : std::uint8_t {
+        READY,          // Everything offered was accepted, so rendering continues.
+        WOULD_BLOCK,    // Rendering pauses until resumed (e.g. once a socket is writable).
+    };
+
+    // Offered the render buffer whenever it reaches the render buffer size,
+    // and at the end, to consume (and erase) as much of it as it can:
+    typedef std::function<SinkStatus(std::string&)> RenderSinkFn;
+
+    struct RenderOptions {
+        mutable PlaceholderPopulator placeholderPopulator{noopPopulator};
+        mutable const PlaceholderValues* placeholderValues{nullptr};
+        // Used instead of the populator when set:
+        mutable PlaceholderWriterFn placeholderWriter{};
+        // Identifies the locale (or anything else) placeholders are populated
+        // for, so that cached fragments can be reused (0 = don't use caches):
+        mutable std::size_t placeholderLocale{0};
+        // Leave out the end tags, quotes & values that HTML allows to be left out:
+        mutable bool minify{false};
+        // Render collected component styles shortened & merged (see CssOptimizer):
+        mutable bool optimizeCss{false};
+        mutable RenderReceiverFn renderReceiverFn{renderToInternalBuffer};
+        mutable std::size_t renderBufferSize{renderBufferDefaultSize};
+        mutable std::string renderBuffer{};
+        mutable RenderFlushFn renderFlushFn{};
+        mutable RenderSinkFn renderSinkFn{};
+        mutable ContentHash* contentHash{nullptr};
+        mutable RenderStats* stats{nullptr};
+
+        RenderOptions()
+        {}
+        RenderOptions(PlaceholderPopulator tPlaceholderPopulator) :
+            placeholderPopulator{tPlaceholderPopulator}
+        {}
+        RenderOptions(PlaceholderPopulator tPlaceholderPopulator, RenderReceiverFn tReceiverFn) :
+            placeholderPopulator{tPlaceholderPopulator},
+            renderReceiverFn{tReceiverFn},
+            renderBufferSize(0)
+        {}
+        RenderOptions(PlaceholderPopulator tPlaceholderPopulator, RenderReceiverFn tReceiverFn, std::size_t tRenderBufferSize) :
+            placeholderPopulator{tPlaceholderPopulator},
+            renderReceiverFn(tReceiverFn),
+            renderBufferSize(tRenderBufferSize)
+        {}
+        RenderOptions(PlaceholderPopulator tPlaceholderPopulator, RenderReceiverFn tReceiverFn, std::size_t tRenderBufferSize, RenderFlushFn tFlushFn) :
+            placeholderPopulator{tPlaceholderPopulator},
+            renderReceiverFn(tReceiverFn),
+            renderBufferSize(tRenderBufferSize),
+            renderFlushFn(tFlushFn)
+        {}
+    };
+
+    typedef std::unordered_set<CollectedCss> CollectedCsses;
+
+    // A head element, kept once however many times (and wherever) it appears:
+    struct CollectedHead {
+        ComponentTypeId componentTypeId;
+        const HtmlNode* node;
+        std::uint64_t hash;
+    };
+
+    // Content that is only produced later (lazily or by a generator), CSS and
+    // cached fragments aren't compared, so such nodes are only ever the same
+    // as themselves:
+    inline bool isOpaque (const HtmlNode& node) {
+        const HtmlNodeExtra* extra = node.data.extra.get();
+        return extra && (extra->contentLazy || extra->contentGenerator.cursor || !extra->css.empty() || extra->cachedFragment);
+    }
+
+    // Digests the tag, attributes, content & children of a node, as it would
+    // be rendered, or the identity of a node that is opaque:
+    inline std::uint64_t headHash (const HtmlNode& head, const std::uint64_t seed = 0) {
+        static constexpr char separator[1] = {'\0'};
+        ContentHash hash{seed};
+        auto updateSize = [&hash] (const std::size_t size) {
+            const std::uint64_t sized{size};
+            hash.update({reinterpret_cast<const char*>(&sized), sizeof(sized)});
+        };
+        auto updateText = [&hash, &updateSize] (const Text& text) {
+            const char type = static_cast<char>(text.type);
+            hash.update({&type, 1});
+            hash.update({reinterpret_cast<const char*>(&text.slot), sizeof(text.slot)});
+            updateSize(text.view.size());
+            hash.update(text.view);
+        };
+        SmallVector<const HtmlNode*, 8> pending;
+        pending.push_back(&head);
+        while (!pending.empty()) {
+            const HtmlNode& node = *pending.back();
+            pending.pop_back();
+            if (isOpaque(node)) {
+                ContentHash identity{seed};
+                const HtmlNode* address = &head;
+                identity.update({separator, 1});
+                identity.update({reinterpret_cast<const char*>(&address), sizeof(address)});
+                return identity.digest();
+            }
+            hash.update(node.data.options.tagName());
+            updateSize(node.data.attributes.size());
+            for (auto &attribute : node.data.attributes) {
+                hash.update(attribute.data.name());
+                updateSize(attribute.data.values.size());
+                for (auto &value : attribute.data.values) {
+                    updateText(value);
+                }
+            }
+            updateText(node.data.content);
+            // Marks where the children end, so that nesting is part of the digest:
+            updateSize(node.data.children.size());
+            for (auto it = node.data.children.rbegin(); it != node.data.children.rend(); ++it) {
+                pending.push_back(&*it);
+            }
+        }
+        return hash.digest();
+    }
+
+    inline std::uint64_t nodesHash (const std::vector<HtmlNode>& nodes) {
+        std::uint64_t hash{0};
+        for (auto &node : nodes) {
+            hash = headHash(node, hash);
+        }
+        return hash;
+    }
+
+    // Whether two nodes render the same, as a digest can't tell for certain:
+    inline bool sameNodes (const HtmlNode& first, const HtmlNode& second) {
+        auto sameText = [] (const Text& a, const Text& b) {
+            return a.type == b.type && a.slot == b.slot && a.view == b.view;
+        };
+        SmallVector<std::pair<const HtmlNode*, const HtmlNode*>, 8> pending;
+        pending.push_back({&first, &second});
+        while (!pending.empty()) {
+            const auto [a, b] = pending.back();
+            pending.pop_back();
+            if (a == b) {
+                continue;
+            }
+            if (isOpaque(*a) || isOpaque(*b)
+                || a->data.options.tag != b->data.options.tag
+                || a->data.options.gathersCollection != b->data.options.gathersCollection
+                || a->data.options.emitsCollection != b->data.options.emitsCollection
+                || a->data.componentTypeId() != b->data.componentTypeId()
+                || !sameText(a->data.content, b->data.content)
+                || a->data.attributes.size() != b->data.attributes.size()
+                || a->data.children.size() != b->data.children.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < a->data.attributes.size(); ++i) {
+                const auto& aValues = a->data.attributes[i].data.values;
+                const auto& bValues = b->data.attributes[i].data.values;
+                if (a->data.attributes[i].data.name() != b->data.attributes[i].data.name() || aValues.size() != bValues.size()) {
+                    return false;
+                }
+                for (std::size_t j = 0; j < aValues.size(); ++j) {
+                    if (!sameText(aValues[j], bValues[j])) {
+                        return false;
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < a->data.children.size(); ++i) {
+                pending.push_back({&a->data.children[i], &b->data.children[i]});
+            }
+        }
+        return true;
+    }
+
+    // Indexes of collected nodes by their digests, to find those that render the same:
+    typedef std::unordered_multimap<std::uint64_t, std::size_t> CollectedIndexes;
+
+    // The nodes of a script or named collection in the order collected,
+    // kept once per component type, or (outside of any component) per content:
+    class CollectedHtmls {
+        std::vector<CollectedHtml> collected;
+        std::unordered_set<ComponentTypeId> components;
+        CollectedIndexes indexes;
+
+        static bool sameNodes (const std::vector<HtmlNode>& first, const std::vector<HtmlNode>& second) {
+            if (first.size() != second.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < first.size(); ++i) {
+                if (!internal::sameNodes(first[i], second[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        public:
+        CollectedHtmls () : collected{}, components{}, indexes{} {}
+
+        bool contains (const CollectedHtml& collectedHtml) const {
+            if (collectedHtml.componentTypeId) {
+                return components.count(collectedHtml.componentTypeId) != 0;
+            }
+            auto [it, end] = indexes.equal_range(collectedHtml.hash);
+            for (; it != end; ++it) {
+                if (sameNodes(collected[it->second].nodes, collectedHtml.nodes)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void insert (const CollectedHtml& collectedHtml) {
+            if (collectedHtml.componentTypeId) {
+                if (!components.insert(collectedHtml.componentTypeId).second) {
+                    return;
+                }
+            } else if (contains(collectedHtml)) {
+                return;
+            } else {
+                indexes.emplace(collectedHtml.hash, collected.size());
+            }
+            collected.push_back(collectedHtml);
+        }
+
+        std::vector<CollectedHtml>::const_iterator begin () const { return collected.begin(); }
+        std::vector<CollectedHtml>::const_iterator end () const { return collected.end(); }
+        std::vector<CollectedHtml>::const_reverse_iterator rbegin () const { return collected.rbegin(); }
+        std::vector<CollectedHtml>::const_reverse_iterator rend () const { return collected.rend(); }
+        std::size_t size () const { return collected.size(); }
+    };
+
+    // A position in a list of sibling nodes being collected:
+    struct CollectFrame {
+        HtmlNode* nodes;
+        std::size_t index;
+        std::size_t size;
+        ComponentTypeId component;
+    };
+
+    struct Collector {
+        CollectedCsses csses;
+        // Head elements in the order collected, with those that render the
+        // same (or belong to a component type already seen) left out:
+        std::vector<CollectedHead> heads;
+        CollectedIndexes headIndexes;
+        std::unordered_set<ComponentTypeId> headComponents;
+        CollectedHtmls scripts;
+        // Variables of components in the order collected, then those declared
+        // outside of any component (which override them):
+        std::vector<CollectedCss> variables;
+        std::unordered_set<ComponentTypeId> variableComponents;
+        std::vector<const std::vector<CssRule>*> pageVariables;
+        // User-defined collections, by their targets:
+        std::unordered_map<CollectionTarget, CollectedHtmls> named;
+        RenderStats* stats;
+        // Collections taken from generated nodes, which don't outlive collection:
+        std::vector<std::unique_ptr<std::vector<CssRule>>> ownedCsses;
+        std::vector<std::unique_ptr<std::vector<HtmlNode>>> ownedHtmls;
+        SmallVector<CollectFrame, 16> frames;
+        std::size_t locale;
+        bool minify;
+        // Every collection seen, whether already collected or not:
+        std::size_t collections;
+        // Multi-pass generators are only walked (calling their callbacks an
+        // extra time) once collection is done, and only if a target was seen:
+        std::vector<std::pair<HtmlNode*, ComponentTypeId>> generated;
+        bool targeted;
+
+        Collector(const RenderOptions& tOptions) :
+            csses{}, heads{}, headIndexes{}, headComponents{}, scripts{}, variables{}, variableComponents{}, pageVariables{}, named{}, stats{tOptions.stats}, ownedCsses{}, ownedHtmls{}, frames{},
+            locale{tOptions.placeholderLocale}, minify{tOptions.minify}, collections{0}, generated{}, targeted{false} {};
+        Collector(RenderStats* tStats, const std::size_t tLocale, const bool tMinify) :
+            csses{}, heads{}, headIndexes{}, headComponents{}, scripts{}, variables{}, variableComponents{}, pageVariables{}, named{}, stats{tStats}, ownedCsses{}, ownedHtmls{}, frames{},
+            locale{tLocale}, minify{tMinify}, collections{0}, generated{}, targeted{false} {};
+
+        // Where the nodes of a script or named collection are kept:
+        CollectedHtmls* htmls (const CollectionTarget target) {
+            switch (target) {
+                case SCRIPT: return &scripts;
+                default: return target >= NAMED ? &named[target] : nullptr;
+            }
+        }
+
+        const CollectedHtmls* htmls (const CollectionTarget target) const {
+            static const CollectedHtmls nothing{};
+            switch (target) {
+                case SCRIPT: return &scripts;
+                default: {
+                    if (target < NAMED) {
+                        return nullptr;
+                    }
+                    auto found = named.find(target);
+                    return found == named.end() ? &nothing : &found->second;
+                }
+            }
+        }
+
+        void collect (HtmlNode* node, const ComponentTypeId currentComponent) {
+            frames.push_back({node, 0, 1, currentComponent});
+            run();
+            if (targeted) {
+                collectGenerated();
+            }
+            generated.clear();
+        }
+
+        void collect (std::vector<HtmlNode>* tNodes, const ComponentTypeId currentComponent) {
+            frames.push_back({tNodes->data(), 0, tNodes->size(), currentComponent});
+            run();
+            if (targeted) {
+                collectGenerated();
+            }
+            generated.clear();
+        }
+
+        template<class T>
+        void collect (std::vector<T>* tNodes, const ComponentTypeId currentComponent) {
+            for (auto &node : *tNodes) {
+                this->collect(&node, currentComponent);
+            }
+        }
+
+        void collect (const void*, const ComponentTypeId) {}
+
+        void adopt (const Collector& other) {
+            for (auto &collectedCss : other.csses) {
+                if (!csses.count(collectedCss)) {
+                    ownedCsses.emplace_back(new std::vector<CssRule>(collectedCss.css));
+                    csses.insert({collectedCss.componentTypeId, *ownedCsses.back()});
+                }
+            }
+            for (auto &collectedVariables : other.variables) {
+                if (variableComponents.insert(collectedVariables.componentTypeId).second) {
+                    ownedCsses.emplace_back(new std::vector<CssRule>(collectedVariables.css));
+                    variables.push_back({collectedVariables.componentTypeId, *ownedCsses.back()});
+                }
+            }
+            for (auto pageVariable : other.pageVariables) {
+                ownedCsses.emplace_back(new std::vector<CssRule>(*pageVariable));
+                pageVariables.push_back(ownedCsses.back().get());
+            }
+            headComponents.insert(other.headComponents.begin(), other.headComponents.end());
+            for (auto &collectedHead : other.heads) {
+                if (!hasHead(*collectedHead.node, collectedHead.hash)) {
+                    ownedHtmls.emplace_back(new std::vector<HtmlNode>{*collectedHead.node});
+                    addHead({collectedHead.componentTypeId, ownedHtmls.back()->data(), collectedHead.hash});
+                }
+            }
+            adopt(scripts, other.scripts);
+            for (auto &[target, collectedHtmls] : other.named) {
+                adopt(named[target], collectedHtmls);
+            }
+        }
+
+        void adopt (CollectedHtmls& htmls, const CollectedHtmls& otherHtmls) {
+            for (auto &collectedHtml : otherHtmls) {
+                if (!htmls.contains(collectedHtml)) {
+                    ownedHtmls.emplace_back(new std::vector<HtmlNode>(collectedHtml.nodes));
+                    htmls.insert({collectedHtml.componentTypeId, *ownedHtmls.back(), collectedHtml.hash});
+                }
+            }
+        }
+
+        private:
+
+        // Nodes are traversed using an explicit stack rather than recursion,
+        // so that deeply nested documents can't overflow the call stack:
+        void run (const std::size_t floor = 0) {
+            while (frames.size() > floor) {
+                CollectFrame& frame = frames.back();
+                if (frame.index == frame.size) {
+                    frames.pop_back();
+                } else {
+                    HtmlNode* node = frame.nodes + frame.index++;
+                    if (node->data.options.gathersCollection != NONE && node->data.options.gathersCollection != PLACEHOLDER) {
+                        targeted = true;
+                    }
+                    if (node->data.extra || node->data.options.emitsCollection != NONE) {
+                        visit(node, frame.component);
+                    } else if (!node->data.children.empty()) {
+                        // Plain nodes have nothing to collect, other than from their children:
+                        frames.push_back({node->data.children.data(), 0, node->data.children.size(), frame.component});
+                    }
+                }
+            }
+        }
+
+        void visit (HtmlNode* node, const ComponentTypeId currentComponent) {
+            ComponentTypeId nextComponent = currentComponent;
+            HtmlNodeExtra* extra = node->data.extra.get();
+            if (extra && extra->componentTypeId) {
+                nextComponent = extra->componentTypeId;
+            }
+
+            if (node->data.options.emitsCollection == HEAD && !node->data.children.empty()) {
+                collectHeads(node->data.children, nextComponent);
+                ++collections;
+            } else if (node->data.options.emitsCollection != NONE && !node->data.children.empty()) {
+                if (CollectedHtmls* collected = htmls(node->data.options.emitsCollection)) {
+                    collected->insert({nextComponent, node->data.children, nextComponent ? 0 : nodesHash(node->data.children)});
+                    ++collections;
+                }
+            }
+
+            if (extra && node->data.options.emitsCollection == CSS && !extra->css.empty()) {
+                csses.insert({nextComponent, extra->css});
+                ++collections;
+            }
+
+            if (extra && node->data.options.emitsCollection == VARIABLE && !extra->css.empty()) {
+                if (nextComponent) {
+                    if (variableComponents.insert(nextComponent).second) {
+                        variables.push_back({nextComponent, extra->css});
+                    }
+                } else {
+                    pageVariables.push_back(&extra->css);
+                }
+                ++collections;
+            }
+
+            if (extra && extra->cachedFragment && locale) {
+                visitCached(node, *extra, nextComponent);
+                return;
+            }
+
+            if (extra && extra->contentLazy) {
+                WEBXX_OBSERVE(stats, lazyStart())
+                node->data.children.push_back(extra->contentLazy());
+                WEBXX_OBSERVE(stats, lazyStop())
+            }
+
+            if (extra && extra->contentGenerator.multiPass) {
+                generated.emplace_back(node, nextComponent);
+            }
+
+            // Children are only pushed once complete, as lazy content may have been added:
+            if (!node->data.children.empty()) {
+                frames.push_back({node->data.children.data(), 0, node->data.children.size(), nextComponent});
+            }
+        }
+
+        // Walk a separate pass over each range, keeping only what is collected:
+        void collectGenerated (const std::size_t from = 0) {
+            for (std::size_t i = from; i < generated.size(); ++i) {
+                auto [node, component] = generated[i];
+                ContentCursor cursor = node->data.extra->contentGenerator.cursor();
+                while (std::optional<HtmlNode> item = cursor()) {
+                    Collector generatedCollector{stats, locale, minify};
+                    generatedCollector.targeted = true;
+                    generatedCollector.collect(&*item, component);
+                    collections += generatedCollector.collections;
+                    adopt(generatedCollector);
+                }
+            }
+            generated.resize(from);
+        }
+
+        void collectHeads (const std::vector<HtmlNode>& nodes, const ComponentTypeId currentComponent) {
+            // The head elements of a component type are the same for each instance:
+            if (currentComponent && !headComponents.insert(currentComponent).second) {
+                return;
+            }
+            for (auto &node : nodes) {
+                const std::uint64_t hash = headHash(node);
+                if (!hasHead(node, hash)) {
+                    addHead({currentComponent, &node, hash});
+                }
+            }
+        }
+
+        bool hasHead (const HtmlNode& node, const std::uint64_t hash) const {
+            auto [it, end] = headIndexes.equal_range(hash);
+            for (; it != end; ++it) {
+                if (sameNodes(*heads[it->second].node, node)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void addHead (CollectedHead&& head) {
+            headIndexes.emplace(head.hash, heads.size());
+            heads.push_back(std::move(head));
+        }
+
+        void visitCached (HtmlNode* node, HtmlNodeExtra& extra, const ComponentTypeId currentComponent) {
+            CachedFragment& fragment = *extra.cachedFragment;
+            if (!fragment.cache->cacheable()) {
+                extra.cachedFragment.reset();
+                visit(node, currentComponent);
+                return;
+            }
+
+            fragment.rendered = fragment.cache->find(locale, minify, currentComponent, fragment.generation);
+            if (fragment.rendered) {
+                return;
+            }
+
+            WEBXX_OBSERVE(stats, lazyStart())
+            node->data.children.push_back(extra.contentLazy());
+            WEBXX_OBSERVE(stats, lazyStop())
+
+            // Collect the subtree on its own, to find out if it can be cached.
+            // Neither what it collects nor what it renders of collections can be:
+            const std::size_t before = collections;
+            const bool targetedBefore = targeted;
+            const std::size_t floor = frames.size();
+            const std::size_t pending = generated.size();
+            targeted = false;
+            frames.push_back({node->data.children.data(), 0, node->data.children.size(), currentComponent});
+            run(floor);
+            collectGenerated(pending);
+            if (collections != before || targeted) {
+                fragment.cache->uncacheable();
+                fragment.generation = 0;
+            }
+            targeted = targeted || targetedBefore;
+        }
+    };
+
+    // A single "property:value" line of an optimized rule:
+    struct CssDeclaration {
+        std::string_view property;
+        std::string value;
+    };
+
+    // A rule (or run of declarations) of an optimized sheet, before it is written out:
+    struct CssBlock {
+        enum Kind : std::uint8_t {
+            DECLARATIONS,   // Declarations outside of a style rule (e.g. nested in one).
+            STYLE,          // A style rule that only has declarations.
+            VERBATIM,       // Anything else, already optimized & written out.
+        };
+        Kind kind;
+        std::string selectors;
+        std::vector<CssDeclaration> declarations;
+        std::string text;
+    };
+
+    // Shortens the values of collected component styles, merges their rules &
+    // drops their overridden properties. Because component styles are static,
+    // each component type is only optimized once (see optimizedCss):
+    class CssOptimizer {
+        public:
+
+        static std::string optimize (const std::vector<CssRule>& css, const ComponentTypeId component) {
+            std::string optimized;
+            optimizeRules(css, component, optimized);
+            return optimized;
+        }
+
+        // Shortens colors (#ffffff to #fff) & zero lengths (0px to 0), leaving
+        // strings & anything between parentheses (e.g. calc, url) untouched.
+        // Custom properties are left as they are, as they may be used anywhere,
+        // and so is flex-basis, where a unitless zero would be a flex factor:
+        static std::string shortenValue (const std::string_view& label, const std::string_view& value) {
+            if (label.substr(0, 2) == "--") {
+                return std::string{value};
+            }
+            const bool keepsZeros = label == "flex" || label == "flex-basis";
+            std::string shortened;
+            shortened.reserve(value.size());
+            std::size_t depth = 0;
+            char quote = 0;
+            for (std::size_t i = 0; i < value.size(); ++i) {
+                const char c = value[i];
+                if (quote) {
+                    quote = (c == quote) ? 0 : quote;
+                } else if (c == '"' || c == '\'') {
+                    quote = c;
+                } else if (c == '(') {
+                    ++depth;
+                } else if (c == ')' && depth) {
+                    --depth;
+                } else if (!depth && startsToken(value, i)) {
+                    const std::size_t end = tokenEnd(value, i);
+                    const std::string_view token = value.substr(i, end - i);
+                    if (shortenColor(token, shortened) || (!keepsZeros && shortenZero(token, shortened))) {
+                        i = end - 1;
+                        continue;
+                    }
+                }
+                shortened += c;
+            }
+            return shortened;
+        }
+
+        private:
+
+        static bool isDelimiter (const char c) {
+            return c == ' ' || c == ',' || c == '/' || c == '\t' || c == '\n';
+        }
+
+        static bool isHex (const char c) {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        static char lower (const char c) {
+            return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+
+        static bool startsToken (const std::string_view& value, const std::size_t i) {
+            return i == 0 || isDelimiter(value[i - 1]);
+        }
+
+        static std::size_t tokenEnd (const std::string_view& value, std::size_t i) {
+            while (i < value.size() && !isDelimiter(value[i]) && value[i] != '(' && value[i] != ')') {
+                ++i;
+            }
+            return i;
+        }
+
+        // #rrggbb to #rgb & #rrggbbaa to #rgba, where each pair repeats:
+        static bool shortenColor (const std::string_view& token, std::string& shortened) {
+            if (token.front() != '#' || (token.size() != 7 && token.size() != 9)) {
+                return false;
+            }
+            for (std::size_t i = 1; i < token.size(); i += 2) {
+                if (!isHex(token[i]) || lower(token[i]) != lower(token[i + 1])) {
+                    return false;
+                }
+            }
+            shortened += '#';
+            for (std::size_t i = 1; i < token.size(); i += 2) {
+                shortened += token[i];
+            }
+            return true;
+        }
+
+        // Only lengths, as a zero time, angle or percentage may need its unit:
+        static bool shortenZero (const std::string_view& token, std::string& shortened) {
+            static constexpr std::string_view lengthUnits[] = {
+                "px", "em", "rem", "ex", "ch", "vw", "vh", "vmin", "vmax", "cm", "mm", "in", "pt", "pc", "q",
+            };
+            if (token.size() < 2 || token.front() != '0') {
+                return false;
+            }
+            std::string unit;
+            for (std::size_t i = 1; i < token.size(); ++i) {
+                unit += lower(token[i]);
+            }
+            for (const auto& lengthUnit : lengthUnits) {
+                if (unit == lengthUnit) {
+                    shortened += '0';
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static bool isImportant (const std::string_view& value) {
+            static constexpr std::string_view important{"!important"};
+            return value.size() >= important.size() && value.substr(value.size() - important.size()) == important;
+        }
+
+        // Browsers skip values they don't understand, so a property repeated
+        // with a function or a vendor prefix is kept as a fallback:
+        static bool mayBeFallback (const std::string_view& value) {
+            return value.find('(') != std::string_view::npos || value.find('-') == 0;
+        }
+
+        // A selector list is dropped if any of its selectors isn't understood,
+        // so vendor prefixed pseudo selectors are never merged with others:
+        static bool mayBeUnsupported (const std::string_view& selectors) {
+            return selectors.find(":-") != std::string_view::npos;
+        }
+
+        static bool isDeclaration (const CssRule& rule) {
+            return !rule.data.canNest && rule.data.label[0] != '@';
+        }
+
+        static void dropOverridden (std::vector<CssDeclaration>& declarations) {
+            std::vector<CssDeclaration> kept;
+            kept.reserve(declarations.size());
+            for (std::size_t i = 0; i < declarations.size(); ++i) {
+                const CssDeclaration& declaration = declarations[i];
+                bool overridden = false;
+                for (std::size_t j = i + 1; j < declarations.size() && !overridden; ++j) {
+                    const CssDeclaration& later = declarations[j];
+                    if (later.property != declaration.property) {
+                        continue;
+                    }
+                    overridden = later.value == declaration.value || (
+                        (isImportant(later.value) || !isImportant(declaration.value)) &&
+                        !mayBeFallback(later.value) && !mayBeFallback(declaration.value)
+                    );
+                }
+                if (!overridden) {
+                    kept.push_back(declaration);
+                }
+            }
+            declarations = std::move(kept);
+        }
+
+        static void renderDeclarations (const std::vector<CssDeclaration>& declarations, std::string& out) {
+            bool shouldSeparate = false;
+            for (const auto& declaration : declarations) {
+                if (shouldSeparate) {
+                    out += ';';
+                }
+                out.append(declaration.property).append(":").append(declaration.value);
+                shouldSeparate = true;
+            }
+        }
+
+        static void renderSelectors (const CssSelectors& selectors, const ComponentTypeId component, std::string& out) {
+            bool shouldSeparate = false;
+            for (const auto& selector : selectors) {
+                if (shouldSeparate) {
+                    out += ',';
+                }
+                out.append(selector.view);
+                if (component) {
+                    out.append("[").append(componentScopePrefix).append(std::to_string(component)).append("]");
+                }
+                shouldSeparate = true;
+            }
+        }
+
+        static CssBlock toBlock (const CssRule& rule, const ComponentTypeId component) {
+            if (!rule.data.canNest) {
+                // Single line @rule:
+                CssBlock block{CssBlock::VERBATIM, {}, {}, rule.data.label};
+                if (!rule.data.selectors.empty()) {
+                    block.text += ' ';
+                    renderSelectors(rule.data.selectors, 0, block.text);
+                }
+                if (!rule.data.value.view.empty()) {
+                    block.text.append(":").append(rule.data.value.view);
+                }
+                block.text += ';';
+                return block;
+            }
+
+            if (rule.data.label[0] != '\0') {
+                // Nested @rule:
+                CssBlock block{CssBlock::VERBATIM, {}, {}, rule.data.label};
+                block.text += ' ';
+                renderSelectors(rule.data.selectors, 0, block.text);
+                block.text += '{';
+                optimizeRules(rule.data.children, component, block.text);
+                block.text += '}';
+                return block;
+            }
+
+            CssBlock block{CssBlock::STYLE, {}, {}, {}};
+            renderSelectors(rule.data.selectors, component, block.selectors);
+            if (std::all_of(rule.data.children.begin(), rule.data.children.end(), isDeclaration)) {
+                for (const auto& child : rule.data.children) {
+                    block.declarations.push_back({child.data.label, shortenValue(child.data.label, child.data.value.view)});
+                }
+            } else {
+                // Style rule with nested rules:
+                block.kind = CssBlock::VERBATIM;
+                block.text = block.selectors;
+                block.text += '{';
+                optimizeRules(rule.data.children, component, block.text);
+                block.text += '}';
+            }
+            return block;
+        }
+
+        static void optimizeRules (const std::vector<CssRule>& rules, const ComponentTypeId component, std::string& out) {
+            std::vector<CssBlock> blocks;
+            for (const auto& rule : rules) {
+                if (isDeclaration(rule)) {
+                    if (blocks.empty() || blocks.back().kind != CssBlock::DECLARATIONS) {
+                        blocks.push_back({CssBlock::DECLARATIONS, {}, {}, {}});
+                    }
+                    blocks.back().declarations.push_back({rule.data.label, shortenValue(rule.data.label, rule.data.value.view)});
+                    continue;
+                }
+
+                CssBlock block = toBlock(rule, component);
+                // Adjacent rules for the same selectors become one:
+                if (block.kind == CssBlock::STYLE && !blocks.empty() &&
+                    blocks.back().kind == CssBlock::STYLE && blocks.back().selectors == block.selectors
+                ) {
+                    for (auto& declaration : block.declarations) {
+                        blocks.back().declarations.push_back(std::move(declaration));
+                    }
+                    continue;
+                }
+                blocks.push_back(std::move(block));
+            }
+
+            // Adjacent rules with the same declarations become one selector list:
+            CssBlock* previous = nullptr;
+            for (auto& block : blocks) {
+                if (block.kind == CssBlock::VERBATIM) {
+                    previous = nullptr;
+                    continue;
+                }
+                dropOverridden(block.declarations);
+                renderDeclarations(block.declarations, block.text);
+                if (block.kind == CssBlock::STYLE && previous && block.text == previous->text &&
+                    !mayBeUnsupported(block.selectors) && !mayBeUnsupported(previous->selectors)
+                ) {
+                    previous->selectors.append(",").append(block.selectors);
+                    block.kind = CssBlock::VERBATIM;
+                    block.text.clear();
+                    continue;
+                }
+                previous = (block.kind == CssBlock::STYLE) ? &block : nullptr;
+            }
+
+            for (std::size_t i = 0; i < blocks.size(); ++i) {
+                const CssBlock& block = blocks[i];
+                if (block.kind == CssBlock::STYLE) {
+                    out.append(block.selectors).append("{").append(block.text).append("}");
+                } else {
+                    out.append(block.text);
+                    if (block.kind == CssBlock::DECLARATIONS && i + 1 < blocks.size()) {
+                        out += ';';
+                    }
+                }
+            }
+        }
+    };
+
+    // The optimized styles of a component type, optimized on first use:
+    inline const std::string& optimizedCss (const ComponentTypeId component, const std::vector<CssRule>& css) {
+        static std::shared_mutex mutex;
+        static std::unordered_map<ComponentTypeId, std::unique_ptr<const std::string>> optimized;
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex);
+            auto found = optimized.find(component);
+            if (found != optimized.end()) {
+                return *found->second;
+            }
+        }
+        auto rendered = std::make_unique<const std::string>(CssOptimizer::optimize(css, component));
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        return *optimized.emplace(component, std::move(rendered)).first->second;
+    }
+
+    // A position in the traversal of a node, or of a list of sibling nodes:
+    struct RenderFrame {
+        enum Stage : std::uint8_t {
+            OPEN,       // Render the opening tag & content, then the children.
+            GENERATE,   // Render the next batch of generated nodes.
+            COLLECTED,  // Render own & collected CSS a rule at a time, then collected head elements.
+            CLOSE,      // Render the closing tag.
+            LIST,       // Render the next of the nodes.
+        };
+
+        const HtmlNode* nodes;
+        std::size_t index;
+        std::size_t size;
+        ComponentTypeId component;
+        Stage stage;
+    };
+
+    struct GeneratorState {
+        ContentCursor cursor;
+        std::vector<HtmlNode> batch;
+        std::size_t batchSize;
+        bool exhausted;
+    };
+
+    // The output of a cached fragment, as it is rendered:
+    struct FragmentCapture {
+        std::size_t depth;
+        std::string rendered;
+    };
+
+    struct Renderer {
+        const Collector& collector;
+        const RenderOptions& options;
+        // Traversal state, kept so that a render can be paused & resumed:
+        SmallVector<RenderFrame, 32> frames;
+        std::vector<std::unique_ptr<GeneratorState>> generators;
+        std::vector<FragmentCapture> captures;
+        bool paused;
+        const bool sinking;
+        const bool minify;
+        // When minifying, an end tag that may be left out depending on what follows:
+        NameId pendingEnd;
+
+        Renderer(const Collector& tCollector, const RenderOptions& tOptions) :
+            collector{tCollector}, options{tOptions}, frames{}, generators{}, captures{}, paused{false},
+            sinking{tOptions.renderSinkFn != nullptr}, minify{tOptions.minify}, pendingEnd{HtmlTag::NONE}
+        {
+            options.renderBuffer.reserve(options.renderBufferSize);
+            if (!options.placeholderPopulator) {
+                options.placeholderPopulator = noopPopulator;
+            }
+            WEBXX_OBSERVE(options.stats, collected(collector.csses.size(), collector.heads.size()))
+        }
+
+        private:
+
+        inline void sendToRender (const std::string_view& rendered) {
+            if (options.contentHash) {
+                options.contentHash->update(rendered);
+            }
+            WEBXX_OBSERVE(options.stats, sinkFlush(rendered))
+            for (auto& capture : captures) {
+                capture.rendered.append(rendered);
+            }
+            options.renderReceiverFn(rendered, options.renderBuffer);
+            if (sinking && options.renderBuffer.size() >= options.renderBufferSize) {
+                offerToSink();
+            }
+        }
+
+        inline void flushRendered () {
+            if (options.renderFlushFn) {
+                options.renderFlushFn(options.renderBuffer);
+            }
+        }
+
+        static bool canBeUnquoted (const std::string_view& value) {
+            if (value.empty()) {
+                return false;
+            }
+            for (const char c : value) {
+                switch (c) {
+                    case ' ': case '\t': case '\n': case '\f': case '\r':
+                    case '"': case '\'': case '=': case '<': case '>': case '`':
+                        return false;
+                    default:
+                        break;
+                }
+            }
+            return true;
+        }
+
+        // Whether the value of a boolean attribute only says that it's present (e.g.
+        // checked="checked"), rather than being a keyword such as hidden="until-found":
+        static bool isBooleanValue (const HtmlAttributeValues& values, const std::string_view& name) {
+            if (values.size() != 1 || values[0].type != Text::Type::LITERAL) {
+                return false;
+            }
+            const std::string_view value = values[0].view;
+            if (value.empty()) {
+                return true;
+            }
+            if (value.size() != name.size()) {
+                return false;
+            }
+            for (std::size_t i = 0; i < value.size(); ++i) {
+                const char c = value[i];
+                if (((c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c) != name[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Whether the pending end tag can be left out before the start tag of
+        // the next element (or NONE for anything else), or its parent's end tag:
+        static bool canOmitEndTag (const NameId pending, const NameId next, const bool parentEnds) {
+            const std::uint8_t nextFlags = nameInfo<HtmlTag>(next).flags;
+            if (parentEnds) {
+                // Custom elements may be transparent, and </thead> is only implied by <tbody> or <tfoot>:
+                if (next >= HtmlTag::CUSTOM || pending == HtmlTag::thead) {
+                    return false;
+                }
+                return pending != HtmlTag::p || !(nextFlags & TRANSPARENT);
+            }
+            switch (pending) {
+                case HtmlTag::li:
+                    return next == HtmlTag::li;
+                case HtmlTag::p:
+                    return nextFlags & CLOSES_P;
+                case HtmlTag::td:
+                case HtmlTag::th:
+                    return next == HtmlTag::td || next == HtmlTag::th;
+                case HtmlTag::tr:
+                    return next == HtmlTag::tr;
+                case HtmlTag::option:
+                    return next == HtmlTag::option || next == HtmlTag::optgroup;
+                case HtmlTag::thead:
+                case HtmlTag::tbody:
+                    return next == HtmlTag::tbody || next == HtmlTag::tfoot;
+                case HtmlTag::head:
+                case HtmlTag::body:
+                case HtmlTag::html:
+                    return next != HtmlTag::NONE;
+                default:
+                    return false;
+            }
+        }
+
+        void endPending (const NameId next, const bool parentEnds) {
+            const NameId pending = pendingEnd;
+            pendingEnd = HtmlTag::NONE;
+            if (!canOmitEndTag(pending, next, parentEnds)) {
+                sendToRender("</");
+                sendToRender(nameInfo<HtmlTag>(pending).name);
+                sendToRender(">");
+            }
+        }
+
+        // From the table of values if it has the placeholder's slot, otherwise the writer or populator:
+        inline void populate (const Text& placeholder, const std::string_view& name) {
+            if (options.placeholderValues && placeholder.slot < options.placeholderValues->size()) {
+                const std::string_view value = (*options.placeholderValues)[placeholder.slot];
+                if (value.data()) {
+                    sendToRender(value);
+                    return;
+                }
+            }
+            if (options.placeholderWriter) {
+                PlaceholderWriter writer{this, [] (void* renderer, const std::string_view& text) {
+                    static_cast<Renderer*>(renderer)->sendToRender(text);
+                }};
+                options.placeholderWriter(placeholder.view, name, writer);
+            } else {
+                sendToRender(options.placeholderPopulator(placeholder.view, name));
+            }
+        }
+
+        public:
+
+        const std::string componentName (ComponentTypeId type) {
+            return std::to_string(type);
+        }
+
+        void render (const HtmlAttribute& attribute, const ComponentTypeId) {
+            const NameInfo& info = attribute.data.info();
+            const std::string_view name = info.name;
+            sendToRender(name);
+            if (minify && !attribute.data.values.empty()) {
+                const Text& value = attribute.data.values[0];
+                if ((info.flags & BOOLEAN_ATTRIBUTE) && isBooleanValue(attribute.data.values, name)) {
+                    return;
+                }
+                if (attribute.data.values.size() == 1 && value.type == Text::Type::LITERAL && canBeUnquoted(value.view)) {
+                    sendToRender("=");
+                    sendToRender(value.view);
+                    return;
+                }
+            }
+            if (!attribute.data.values.empty()) {
+                sendToRender("=\"");
+                bool shouldSeparate = false;
+                for(auto &value : attribute.data.values) {
+                    if (shouldSeparate) {
+                        sendToRender(" ");
+                    }
+
+                    switch (value.type) {
+                        case Text::Type::LITERAL:
+                            sendToRender(value.view);
+                            break;
+                        case Text::Type::PLACEHOLDER:
+                            populate(value, name);
+                            break;
+                    }
+
+                    shouldSeparate = true;
+                }
+                sendToRender("\"");
+            }
+        }
+
+        void render (const std::initializer_list<HtmlAttribute>& attributes, const ComponentTypeId currentComponent) {
+            for (auto &attribute : attributes) {
+                sendToRender(" ");
+                render(attribute, currentComponent);
+            }
+        }
+
+        void render (const std::vector<HtmlAttribute>& attributes, const ComponentTypeId currentComponent) {
+            for (auto &attribute : attributes) {
+                sendToRender(" ");
+                render(attribute, currentComponent);
+            }
+        }
+
+        void render (const HtmlNode& node, const ComponentTypeId currentComponent) {
+            frames.push_back({&node, 0, 1, currentComponent, RenderFrame::OPEN});
+            run();
+        }
+
+        void render (const std::initializer_list<HtmlNode>& tNodes, const ComponentTypeId currentComponent) {
+            frames.push_back({tNodes.begin(), 0, tNodes.size(), currentComponent, RenderFrame::LIST});
+            run();
+        }
+
+        void render (const std::vector<HtmlNode>& tNodes, const ComponentTypeId currentComponent) {
+            frames.push_back({tNodes.data(), 0, tNodes.size(), currentComponent, RenderFrame::LIST});
+            run();
+        }
+
+        // Whether everything has been rendered & accepted by the sink:
+        bool done () const {
+            return frames.empty() && !paused;
+        }
+
+        // Continue a render paused by the sink, returning whether it is done:
+        bool resume () {
+            paused = false;
+            offerToSink();
+            run();
+            return done();
+        }
+
+        private:
+
+        void offerToSink () {
+            if (options.renderSinkFn && !paused && !options.renderBuffer.empty()) {
+                paused = options.renderSinkFn(options.renderBuffer) == SinkStatus::WOULD_BLOCK;
+            }
+        }
+
+        // Nodes are traversed using an explicit stack rather than recursion,
+        // so that the traversal can be paused between any two steps:
+        void run () {
+            while (!frames.empty() && !paused) {
+                RenderFrame& frame = frames.back();
+                switch (frame.stage) {
+                    case RenderFrame::OPEN:
+                        open(frame);
+                        break;
+                    case RenderFrame::GENERATE:
+                        generate(frame);
+                        break;
+                    case RenderFrame::COLLECTED:
+                        collected(frame);
+                        break;
+                    case RenderFrame::CLOSE:
+                        close(frame);
+                        break;
+                    case RenderFrame::LIST:
+                        renderLeaves(frame);
+                        if (frame.index == frame.size) {
+                            frames.pop_back();
+                        } else if (!paused) {
+                            const HtmlNode* node = frame.nodes + frame.index++;
+                            frames.push_back({node, 0, 1, frame.component, RenderFrame::OPEN});
+                        }
+                        break;
+                }
+            }
+            if (frames.empty()) {
+                if (pendingEnd) {
+                    // Only the ends of the document's html & body can be left out at its end:
+                    if (pendingEnd == HtmlTag::html || pendingEnd == HtmlTag::body) {
+                        pendingEnd = HtmlTag::NONE;
+                    } else {
+                        endPending(HtmlTag::NONE, false);
+                    }
+                }
+                offerToSink();
+            }
+        }
+
+        // Targets render what was collected for them, after their own children:
+        static bool isTarget (const HtmlNode& node) {
+            return node.data.options.gathersCollection != NONE
+                && node.data.options.gathersCollection != PLACEHOLDER;
+        }
+
+        static bool isLeaf (const HtmlNode& node) {
+            return node.data.children.empty()
+                && !node.data.extra
+                && node.data.options.emitsCollection == NONE
+                && !isTarget(node);
+        }
+
+        // Leaf nodes are rendered straight away, rather than with frames of their own:
+        void renderLeaves (RenderFrame& frame) {
+            while (frame.index < frame.size && !paused && isLeaf(frame.nodes[frame.index])) {
+                const HtmlNode& node = frame.nodes[frame.index++];
+                WEBXX_OBSERVE(options.stats, node())
+                WEBXX_OBSERVE(options.stats, componentEnter(0))
+                openTag(node, frame.component);
+                closeTag(node);
+                WEBXX_OBSERVE(options.stats, componentExit(0))
+            }
+        }
+
+        void open (RenderFrame& frame) {
+            const HtmlNode& node = *frame.nodes;
+            if (node.data.options.emitsCollection != NONE) {
+                // Nodes belonging to a collection will be rendered where they are collected:
+                frames.pop_back();
+                return;
+            }
+
+            const HtmlNodeExtra* extra = node.data.extra.get();
+            if (extra && extra->cachedFragment) {
+                if (extra->cachedFragment->rendered) {
+                    if (pendingEnd) {
+                        endPending(HtmlTag::NONE, false);
+                    }
+                    sendToRender(*extra->cachedFragment->rendered);
+                    frames.pop_back();
+                    return;
+                }
+                if (extra->cachedFragment->generation) {
+                    // Cached output can't contain the end of what precedes it:
+                    if (pendingEnd) {
+                        endPending(HtmlTag::NONE, false);
+                    }
+                    captures.push_back({frames.size(), {}});
+                }
+            }
+
+            const ComponentTypeId componentTypeId = extra ? extra->componentTypeId : 0;
+            if (componentTypeId) {
+                frame.component = componentTypeId;
+            }
+
+            WEBXX_OBSERVE(options.stats, node())
+            WEBXX_OBSERVE(options.stats, componentEnter(componentTypeId))
+
+            openTag(node, frame.component);
+
+            frame.stage = (extra && extra->contentGenerator.cursor) ? RenderFrame::GENERATE : RenderFrame::COLLECTED;
+            RenderFrame children{node.data.children.data(), 0, node.data.children.size(), frame.component, RenderFrame::LIST};
+            renderLeaves(children);
+            if (children.index < children.size) {
+                frames.push_back(std::move(children));
+            } else if (!extra && !isTarget(node)) {
+                close(frame);
+            }
+        }
+
+        void openTag (const HtmlNode& node, const ComponentTypeId nextComponent) {
+            const NameInfo& tag = node.data.options.info();
+            const bool hasTag = !tag.name.empty() && !(tag.flags & VERBATIM);
+
+            if (pendingEnd && (!tag.name.empty() || !node.data.content.view.empty())) {
+                endPending(hasTag ? node.data.options.tag : NameId{HtmlTag::NONE}, false);
+            }
+
+            if (tag.flags & VERBATIM) {
+                sendToRender(tag.name);
+            }
+
+            if (hasTag) {
+                sendToRender("<");
+                sendToRender(tag.name);
+                if (!node.data.attributes.empty()) {
+                    render(node.data.attributes, nextComponent);
+                }
+                if (nextComponent) {
+                    sendToRender(" ");
+                    sendToRender(componentScopePrefix);
+                    sendToRender(componentName(nextComponent));
+                }
+                if ((tag.flags & VOID_ELEMENT) && !minify) {
+                    sendToRender("/");
+                }
+                sendToRender(">");
+            }
+
+            if (node.data.options.gathersCollection == PLACEHOLDER) {
+                populate(node.data.content, tag.name);
+            } else {
+                sendToRender(node.data.content.view);
+            }
+        }
+
+        void closeTag (const HtmlNode& node) {
+            const NameInfo& tag = node.data.options.info();
+            if (!tag.name.empty() && !(tag.flags & (VERBATIM | VOID_ELEMENT))) {
+                if (minify) {
+                    if (pendingEnd) {
+                        endPending(node.data.options.tag, true);
+                    }
+                    if (tag.flags & OPTIONAL_END_TAG) {
+                        pendingEnd = node.data.options.tag;
+                        return;
+                    }
+                }
+                sendToRender("</");
+                sendToRender(tag.name);
+                sendToRender(">");
+            }
+        }
+
+        void generate (RenderFrame& frame) {
+            if (!frame.index) {
+                const ContentGenerator& generator = frame.nodes->data.extra->contentGenerator;
+                generators.emplace_back(new GeneratorState{generator.cursor(), {}, generator.batchSize, false});
+                frame.index = 1;
+            } else if (generators.back()->batchSize) {
+                flushRendered();
+            }
+
+            // Each batch is built in the same storage, which is kept between batches:
+            GeneratorState& generator = *generators.back();
+            generator.batch.clear();
+            const std::size_t batchSize = std::max(generator.batchSize, std::size_t{1});
+            while (!generator.exhausted && generator.batch.size() < batchSize) {
+                std::optional<HtmlNode> generated = generator.cursor();
+                if (!generated) {
+                    generator.exhausted = true;
+                    break;
+                }
+                generator.batch.push_back(std::move(*generated));
+            }
+
+            if (generator.batch.empty()) {
+                generators.pop_back();
+                frame.index = 0;
+                frame.stage = RenderFrame::COLLECTED;
+                return;
+            }
+
+            // Expand any lazy content, as the collector never saw these nodes:
+            Collector batchCollector{options};
+            batchCollector.collect(&generator.batch, frame.component);
+            frames.push_back({generator.batch.data(), 0, generator.batch.size(), frame.component, RenderFrame::LIST});
+        }
+
+        // CSS is rendered a rule at a time, counting the rules rendered in the
+        // frame's index, so that a paused render resumes from the next rule:
+        template<typename F>
+        bool renderRule (RenderFrame& frame, std::size_t& rule, F&& renderFn) {
+            if (rule++ < frame.index) {
+                return true;
+            }
+            if (paused) {
+                return false;
+            }
+            renderFn();
+            frame.index = rule;
+            return true;
+        }
+
+        void collected (RenderFrame& frame) {
+            const HtmlNode& node = *frame.nodes;
+            const HtmlNodeExtra* extra = node.data.extra.get();
+
+            std::size_t rule = 0;
+            if (extra) {
+                for (auto &cssRule : extra->css) {
+                    if (!renderRule(frame, rule, [&] () { render(cssRule, 0); })) {
+                        return;
+                    }
+                }
+            }
+
+            if (node.data.options.gathersCollection == CSS) {
+                for (auto &collectedCss : collector.csses) {
+                    if (options.optimizeCss && collectedCss.componentTypeId) {
+                        if (!renderRule(frame, rule, [&] () {
+                            sendToRender(optimizedCss(collectedCss.componentTypeId, collectedCss.css));
+                        })) {
+                            return;
+                        }
+                        continue;
+                    }
+                    for (auto &cssRule : collectedCss.css) {
+                        if (!renderRule(frame, rule, [&] () { render(cssRule, collectedCss.componentTypeId); })) {
+                            return;
+                        }
+                    }
+                }
+            }
+
+            if (node.data.options.gathersCollection == VARIABLE) {
+                renderVariables();
+            }
+
+            const CollectedHtmls* collectedHtmls = collector.htmls(node.data.options.gathersCollection);
+            if (node.data.options.gathersCollection == HEAD) {
+                frame.stage = RenderFrame::CLOSE;
+                pushCollected(collector.heads);
+            } else if (collectedHtmls) {
+                frame.stage = RenderFrame::CLOSE;
+                pushCollected(*collectedHtmls);
+            } else {
+                close(frame);
+            }
+        }
+
+        void close (RenderFrame& frame) {
+            const HtmlNode& node = *frame.nodes;
+            closeTag(node);
+            WEBXX_OBSERVE(options.stats, componentExit(node.data.componentTypeId()))
+            if (!captures.empty() && captures.back().depth == frames.size()) {
+                // Cached output can't depend on what follows it:
+                if (pendingEnd) {
+                    endPending(HtmlTag::NONE, false);
+                }
+                const CachedFragment& fragment = *node.data.extra->cachedFragment;
+                fragment.cache->store(options.placeholderLocale, minify, frame.component, fragment.generation, std::move(captures.back().rendered));
+                captures.pop_back();
+            }
+            frames.pop_back();
+        }
+
+        // Each variable is only declared once: The first component (in document
+        // order) to declare it gives its value, unless it's also declared
+        // outside of any component, where the last declaration wins:
+        void renderVariables () {
+            std::vector<std::pair<std::string_view, std::string_view>> declared;
+            std::unordered_map<std::string_view, std::size_t> indexes;
+            auto declare = [&declared, &indexes] (const std::vector<CssRule>& rules, const bool overrides) {
+                for (auto &rule : rules) {
+                    auto [found, added] = indexes.emplace(rule.data.label, declared.size());
+                    if (added) {
+                        declared.emplace_back(rule.data.label, rule.data.value.view);
+                    } else if (overrides) {
+                        declared[found->second].second = rule.data.value.view;
+                    }
+                }
+            };
+            for (auto &collectedVariables : collector.variables) {
+                declare(collectedVariables.css, false);
+            }
+            for (auto pageVariable : collector.pageVariables) {
+                declare(*pageVariable, true);
+            }
+            if (declared.empty()) {
+                return;
+            }
+
+            sendToRender(":root{");
+            for (auto &[name, value] : declared) {
+                sendToRender(name);
+                sendToRender(":");
+                sendToRender(value);
+                sendToRender(";");
+            }
+            sendToRender("}");
+        }
+
+        void pushCollected (const std::vector<CollectedHead>& collectedHeads) {
+            // Pushed in reverse, so that they are rendered in the order collected:
+            for (auto it = collectedHeads.rbegin(); it != collectedHeads.rend(); ++it) {
+                frames.push_back({it->node, 0, 1, it->componentTypeId, RenderFrame::LIST});
+            }
+        }
+
+        void pushCollected (const CollectedHtmls& collectedHtmls) {
+            // Pushed in reverse, so that they are rendered in the order collected:
+            for (auto it = collectedHtmls.rbegin(); it != collectedHtmls.rend(); ++it) {
+                frames.push_back({it->nodes.data(), 0, it->nodes.size(), it->componentTypeId, RenderFrame::LIST});
+            }
+        }
+
+        public:
+
+        void render(const std::initializer_list<Text>& selectors, const ComponentTypeId currentComponent) {
+            bool shouldSeparate = false;
+            for (auto &selector : selectors) {
+                if (shouldSeparate) {
+                    sendToRender(",");
+                }
+
+                sendToRender(selector.view);
+
+                if (currentComponent) {
+                    sendToRender("[");
+                    sendToRender(componentScopePrefix);
+                    sendToRender(componentName(currentComponent));
+                    sendToRender("]");
+                }
+                shouldSeparate = true;
+            }
+        }
+
+        void render(const CssSelectors& selectors, const ComponentTypeId currentComponent) {
+            bool shouldSeparate = false;
+            for (auto &selector : selectors) {
+                if (shouldSeparate) {
+                    sendToRender(",");
+                }
+
+                sendToRender(selector.view);
+
+                if (currentComponent) {
+                    sendToRender("[");
+                    sendToRender(componentScopePrefix);
+                    sendToRender(componentName(currentComponent));
+                    sendToRender("]");
+                }
+                shouldSeparate = true;
+            }
+        }
+
+        void render (const CssRule& rule, const ComponentTypeId currentComponent) {
+            if (!rule.data.canNest) {
+                // Single line rule:
+                sendToRender(rule.data.label);
+                if (!rule.data.selectors.empty()) {
+                    sendToRender(" ");
+                    render(rule.data.selectors, 0);
+                }
+                if (!rule.data.value.view.empty()) {
+                    sendToRender(":");
+                    sendToRender(rule.data.value.view);
+                }
+                sendToRender(";");
+            } else {
+                // Nested rule:
+                if(strlen(rule.data.label)) {
+                    // @rule (has a label and selectors):
+                    sendToRender(rule.data.label);
+                    sendToRender(" ");
+                    render(rule.data.selectors, 0);
+                } else {
+                    // Style rule (has no label, only selectors):
+                    render(rule.data.selectors, currentComponent);
+                }
+
+                sendToRender("{");
+
+                for (auto &child : rule.data.children) {
+                    render(child, currentComponent);
+                }
+
+                sendToRender("}");
+            }
+        }
+
+        void render (const std::initializer_list<CssRule>& css, const ComponentTypeId currentComponent) {
+            for (auto &rule : css) {
+                render(rule, currentComponent);
+            }
+        }
+
+        void render (const std::vector<CssRule>& css, const ComponentTypeId currentComponent) {
+            for (auto &rule : css) {
+                render(rule, currentComponent);
+            }
+        }
+
+        void render (const CollectedCsses& collectedCsses, const ComponentTypeId) {
+            for (auto &collectedCss : collectedCsses) {
+                if (options.optimizeCss && collectedCss.componentTypeId) {
+                    sendToRender(optimizedCss(collectedCss.componentTypeId, collectedCss.css));
+                } else {
+                    render(collectedCss.css, collectedCss.componentTypeId);
+                }
+            }
+        }
+
+        void render (const CollectedHtmls& collectedHtmls, const ComponentTypeId) {
+            pushCollected(collectedHtmls);
+            run();
+        }
+    };
+
+    namespace exports {
+        template<typename V>
+        Collector collect (V&& tNode, const RenderOptions& options) {
+            Collector collector(options);
+            collector.collect(&tNode, 0);
+            return collector;
+        }
+
+        template<typename V>
+        Collector collect (V&& tNode) {
+            return collect(std::forward<V>(tNode), {});
+        }
+
+        template<typename T>
+        std::string render (T&& thing, const RenderOptions&& options) {
+            Collector collector = collect(thing, options);
+            Renderer renderer(collector, options);
+            renderer.render(std::forward<T>(thing), 0);
+            return options.renderBuffer;
+        }
+
+        template<typename T>
+        std::string render (T&& thing) {
+            return render(std::forward<T>(thing), {});
+        }
+
+        struct HashedRender {
+            std::string output;
+            ContentHash hash;
+        };
+
+        template<typename T>
+        HashedRender renderHashed (T&& thing, const RenderOptions&& options) {
+            ContentHash hash;
+            options.contentHash = &hash;
+            std::string output = render(std::forward<T>(thing), std::move(options));
+            options.contentHash = nullptr;
+            return {std::move(output), hash};
+        }
+
+        template<typename T>
+        HashedRender renderHashed (T&& thing) {
+            return renderHashed(std::forward<T>(thing), {});
+        }
+
+        // Digest the output without buffering it (e.g. to answer with a 304):
+        template<typename T>
+        ContentHash renderHash (T&& thing, const RenderOptions&& options) {
+            options.renderReceiverFn = renderToNowhere;
+            options.renderBufferSize = 0;
+            return renderHashed(std::forward<T>(thing), std::move(options)).hash;
+        }
+
+        template<typename T>
+        ContentHash renderHash (T&& thing) {
+            return renderHash(std::forward<T>(thing), {});
+        }
+
+        using SinkStatus = SinkStatus;
+
+        // A render that pauses whenever its sink would block, holding on to
+        // the document until it has been resumed to completion:
+        class ResumableRender {
+            public:
+
+            ResumableRender (HtmlNode&& tNode, RenderSinkFn tSinkFn, const RenderOptions& tOptions) :
+                node(std::move(tNode)),
+                options{withSink(tOptions, std::move(tSinkFn))},
+                collector{collect(node, options)},
+                renderer{collector, options}
+            {
+                renderer.render(node, 0);
+            }
+
+            ResumableRender (ResumableRender&&) = delete;
+            ResumableRender& operator= (ResumableRender&&) = delete;
+            ResumableRender (const ResumableRender&) = delete;
+            ResumableRender& operator= (const ResumableRender&) = delete;
+
+            bool done () const {
+                return renderer.done();
+            }
+
+            // Continue once the sink can accept more, returning whether the render is done:
+            bool resume () {
+                return renderer.resume();
+            }
+
+            private:
+
+            static RenderOptions withSink (const RenderOptions& tOptions, RenderSinkFn&& tSinkFn) {
+                RenderOptions sinkOptions{tOptions};
+                sinkOptions.renderSinkFn = std::move(tSinkFn);
+                return sinkOptions;
+            }
+
+            HtmlNode node;
+            RenderOptions options;
+            Collector collector;
+            Renderer renderer;
+        };
+
+        template<typename T>
+        ResumableRender renderResumable (T&& thing, RenderSinkFn sinkFn, const RenderOptions&& options) {
+            return ResumableRender(std::forward<T>(thing), std::move(sinkFn), options);
+        }
+
+        template<typename T>
+        ResumableRender renderResumable (T&& thing, RenderSinkFn sinkFn) {
+            return renderResumable(std::forward<T>(thing), std::move(sinkFn), {});
+        }
+
+        template<typename T>
+        std::string renderCss (T&& thing, const RenderOptions&& options) {
+            Collector collector = collect(thing, options);
+            Renderer renderer(collector, options);
+            renderer.render(collector.csses, 0);
+            return options.renderBuffer;
+        }
+
+        template<typename T>
+        std::string renderCss (T&& thing) {
+            return renderCss(std::forward<T>(thing), {});
+        }
+    }
+}}
+
+
+////|          |////
+////|  Public  |////
+////|          |////
+
+
+WEBXX_EXPORT namespace Webxx {
+    // Modules:
+    using namespace internal::exports;
+}
+
+#endif // WEBXX_CORE_H
@@ -0,0 +1,37 @@
+#ifndef WEBXX_CSS_AT_RULES_H
+#define WEBXX_CSS_AT_RULES_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// CSS @ rules (e.g. atMedia).
+
+#include "core.h"
+
+
+////|          |////
+////|  Public  |////
+////|          |////
+
+
+WEBXX_EXPORT namespace Webxx {
+    // CSS @ rules:
+    WEBXX_CSS_AT_SINGLE(@charset,atCharset);
+    WEBXX_CSS_AT_SINGLE(@import,atImport);
+    WEBXX_CSS_AT_SINGLE(@namespace,atNamespace);
+    WEBXX_CSS_AT_NESTED(@media,atMedia);
+    WEBXX_CSS_AT_NESTED(@supports,atSupports);
+    WEBXX_CSS_AT_NESTED(@document,atDocument);
+    WEBXX_CSS_AT_NESTED(@page,atPage);
+    WEBXX_CSS_AT_NESTED(@font-face,atFontFace);
+    WEBXX_CSS_AT_NESTED(@keyframes,atKeyframes);
+    WEBXX_CSS_AT_NESTED(@counter-style,atCounterStyle);
+    WEBXX_CSS_AT_NESTED(@font-feature-values,atFontFeatureValues);
+    WEBXX_CSS_AT_NESTED(@property,atProperty);
+    WEBXX_CSS_AT_NESTED(@layer,atLayer);
+}
+
+#endif // WEBXX_CSS_AT_RULES_H
@@ -0,0 +1,513 @@
+#ifndef WEBXX_CSS_PROPERTIES_H
+#define WEBXX_CSS_PROPERTIES_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// CSS properties (e.g. color).
+
+#include "core.h"
+
+
+////|          |////
+////|  Public  |////
+////|          |////
+
+
+WEBXX_EXPORT namespace Webxx {
+    // CSS properties:
+    WEBXX_CSS_PROP_ALIAS(accent-color, accentColor);
+    WEBXX_CSS_PROP_ALIAS(align-content, alignContent);
+    WEBXX_CSS_PROP_ALIAS(align-items, alignItems);
+    WEBXX_CSS_PROP_ALIAS(align-self, alignSelf);
+    WEBXX_CSS_PROP_ALIAS(alignment-baseline, alignmentBaseline);
+    WEBXX_CSS_PROP(all);
+    WEBXX_CSS_PROP(animation);
+    WEBXX_CSS_PROP_ALIAS(animation-delay, animationDelay);
+    WEBXX_CSS_PROP_ALIAS(animation-direction, animationDirection);
+    WEBXX_CSS_PROP_ALIAS(animation-duration, animationDuration);
+    WEBXX_CSS_PROP_ALIAS(animation-fill-mode, animationFillMode);
+    WEBXX_CSS_PROP_ALIAS(animation-iteration-count, animationIterationCount);
+    WEBXX_CSS_PROP_ALIAS(animation-name, animationName);
+    WEBXX_CSS_PROP_ALIAS(animation-play-state, animationPlayState);
+    WEBXX_CSS_PROP_ALIAS(animation-timing-function, animationTimingFunction);
+    WEBXX_CSS_PROP(appearance);
+    WEBXX_CSS_PROP_ALIAS(aspect-ratio, aspectRatio);
+    WEBXX_CSS_PROP(azimuth);
+    WEBXX_CSS_PROP_ALIAS(backdrop-filter, backdropFilter);
+    WEBXX_CSS_PROP_ALIAS(backface-visibility, backfaceVisibility);
+    WEBXX_CSS_PROP(background);
+    WEBXX_CSS_PROP_ALIAS(background-attachment, backgroundAttachment);
+    WEBXX_CSS_PROP_ALIAS(background-blend-mode, backgroundBlendMode);
+    WEBXX_CSS_PROP_ALIAS(background-clip, backgroundClip);
+    WEBXX_CSS_PROP_ALIAS(background-color, backgroundColor);
+    WEBXX_CSS_PROP_ALIAS(background-image, backgroundImage);
+    WEBXX_CSS_PROP_ALIAS(background-origin, backgroundOrigin);
+    WEBXX_CSS_PROP_ALIAS(background-position, backgroundPosition);
+    WEBXX_CSS_PROP_ALIAS(background-repeat, backgroundRepeat);
+    WEBXX_CSS_PROP_ALIAS(background-size, backgroundSize);
+    WEBXX_CSS_PROP_ALIAS(baseline-shift, baselineShift);
+    WEBXX_CSS_PROP_ALIAS(baseline-source, baselineSource);
+    WEBXX_CSS_PROP_ALIAS(block-ellipsis, blockEllipsis);
+    WEBXX_CSS_PROP_ALIAS(block-size, blockSize);
+    WEBXX_CSS_PROP_ALIAS(bookmark-label, bookmarkLabel);
+    WEBXX_CSS_PROP_ALIAS(bookmark-level, bookmarkLevel);
+    WEBXX_CSS_PROP_ALIAS(bookmark-state, bookmarkState);
+    WEBXX_CSS_PROP(border);
+    WEBXX_CSS_PROP_ALIAS(border-block, borderBlock);
+    WEBXX_CSS_PROP_ALIAS(border-block-color, borderBlockColor);
+    WEBXX_CSS_PROP_ALIAS(border-block-end, borderBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(border-block-end-color, borderBlockEndColor);
+    WEBXX_CSS_PROP_ALIAS(border-block-end-style, borderBlockEndStyle);
+    WEBXX_CSS_PROP_ALIAS(border-block-end-width, borderBlockEndWidth);
+    WEBXX_CSS_PROP_ALIAS(border-block-start, borderBlockStart);
+    WEBXX_CSS_PROP_ALIAS(border-block-start-color, borderBlockStartColor);
+    WEBXX_CSS_PROP_ALIAS(border-block-start-style, borderBlockStartStyle);
+    WEBXX_CSS_PROP_ALIAS(border-block-start-width, borderBlockStartWidth);
+    WEBXX_CSS_PROP_ALIAS(border-block-style, borderBlockStyle);
+    WEBXX_CSS_PROP_ALIAS(border-block-width, borderBlockWidth);
+    WEBXX_CSS_PROP_ALIAS(border-bottom, borderBottom);
+    WEBXX_CSS_PROP_ALIAS(border-bottom-color, borderBottomColor);
+    WEBXX_CSS_PROP_ALIAS(border-bottom-left-radius, borderBottomLeftRadius);
+    WEBXX_CSS_PROP_ALIAS(border-bottom-right-radius, borderBottomRightRadius);
+    WEBXX_CSS_PROP_ALIAS(border-bottom-style, borderBottomStyle);
+    WEBXX_CSS_PROP_ALIAS(border-bottom-width, borderBottomWidth);
+    WEBXX_CSS_PROP_ALIAS(border-boundary, borderBoundary);
+    WEBXX_CSS_PROP_ALIAS(border-collapse, borderCollapse);
+    WEBXX_CSS_PROP_ALIAS(border-color, borderColor);
+    WEBXX_CSS_PROP_ALIAS(border-end-end-radius, borderEndEndRadius);
+    WEBXX_CSS_PROP_ALIAS(border-end-start-radius, borderEndStartRadius);
+    WEBXX_CSS_PROP_ALIAS(border-image, borderImage);
+    WEBXX_CSS_PROP_ALIAS(border-image-outset, borderImageOutset);
+    WEBXX_CSS_PROP_ALIAS(border-image-repeat, borderImageRepeat);
+    WEBXX_CSS_PROP_ALIAS(border-image-slice, borderImageSlice);
+    WEBXX_CSS_PROP_ALIAS(border-image-source, borderImageSource);
+    WEBXX_CSS_PROP_ALIAS(border-image-width, borderImageWidth);
+    WEBXX_CSS_PROP_ALIAS(border-inline, borderInline);
+    WEBXX_CSS_PROP_ALIAS(border-inline-color, borderInlineColor);
+    WEBXX_CSS_PROP_ALIAS(border-inline-end, borderInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(border-inline-end-color, borderInlineEndColor);
+    WEBXX_CSS_PROP_ALIAS(border-inline-end-style, borderInlineEndStyle);
+    WEBXX_CSS_PROP_ALIAS(border-inline-end-width, borderInlineEndWidth);
+    WEBXX_CSS_PROP_ALIAS(border-inline-start, borderInlineStart);
+    WEBXX_CSS_PROP_ALIAS(border-inline-start-color, borderInlineStartColor);
+    WEBXX_CSS_PROP_ALIAS(border-inline-start-style, borderInlineStartStyle);
+    WEBXX_CSS_PROP_ALIAS(border-inline-start-width, borderInlineStartWidth);
+    WEBXX_CSS_PROP_ALIAS(border-inline-style, borderInlineStyle);
+    WEBXX_CSS_PROP_ALIAS(border-inline-width, borderInlineWidth);
+    WEBXX_CSS_PROP_ALIAS(border-left, borderLeft);
+    WEBXX_CSS_PROP_ALIAS(border-left-color, borderLeftColor);
+    WEBXX_CSS_PROP_ALIAS(border-left-style, borderLeftStyle);
+    WEBXX_CSS_PROP_ALIAS(border-left-width, borderLeftWidth);
+    WEBXX_CSS_PROP_ALIAS(border-radius, borderRadius);
+    WEBXX_CSS_PROP_ALIAS(border-right, borderRight);
+    WEBXX_CSS_PROP_ALIAS(border-right-color, borderRightColor);
+    WEBXX_CSS_PROP_ALIAS(border-right-style, borderRightStyle);
+    WEBXX_CSS_PROP_ALIAS(border-right-width, borderRightWidth);
+    WEBXX_CSS_PROP_ALIAS(border-spacing, borderSpacing);
+    WEBXX_CSS_PROP_ALIAS(border-start-end-radius, borderStartEndRadius);
+    WEBXX_CSS_PROP_ALIAS(border-start-start-radius, borderStartStartRadius);
+    WEBXX_CSS_PROP_ALIAS(border-style, borderStyle);
+    WEBXX_CSS_PROP_ALIAS(border-top, borderTop);
+    WEBXX_CSS_PROP_ALIAS(border-top-color, borderTopColor);
+    WEBXX_CSS_PROP_ALIAS(border-top-left-radius, borderTopLeftRadius);
+    WEBXX_CSS_PROP_ALIAS(border-top-right-radius, borderTopRightRadius);
+    WEBXX_CSS_PROP_ALIAS(border-top-style, borderTopStyle);
+    WEBXX_CSS_PROP_ALIAS(border-top-width, borderTopWidth);
+    WEBXX_CSS_PROP_ALIAS(border-width, borderWidth);
+    WEBXX_CSS_PROP(bottom);
+    WEBXX_CSS_PROP_ALIAS(box-decoration-break, boxDecorationBreak);
+    WEBXX_CSS_PROP_ALIAS(box-shadow, boxShadow);
+    WEBXX_CSS_PROP_ALIAS(box-sizing, boxSizing);
+    WEBXX_CSS_PROP_ALIAS(box-snap, boxSnap);
+    WEBXX_CSS_PROP_ALIAS(break-after, breakAfter);
+    WEBXX_CSS_PROP_ALIAS(break-before, breakBefore);
+    WEBXX_CSS_PROP_ALIAS(break-inside, breakInside);
+    WEBXX_CSS_PROP_ALIAS(caption-side, captionSide);
+    WEBXX_CSS_PROP(caret);
+    WEBXX_CSS_PROP_ALIAS(caret-color, caretColor);
+    WEBXX_CSS_PROP_ALIAS(caret-shape, caretShape);
+    WEBXX_CSS_PROP(chains);
+    WEBXX_CSS_PROP(clear);
+    WEBXX_CSS_PROP(clip);
+    WEBXX_CSS_PROP_ALIAS(clip-path, clipPath);
+    WEBXX_CSS_PROP_ALIAS(clip-rule, clipRule);
+    WEBXX_CSS_PROP(color);
+    WEBXX_CSS_PROP_ALIAS(color-adjust, colorAdjust);
+    WEBXX_CSS_PROP_ALIAS(color-interpolation-filters, colorInterpolationFilters);
+    WEBXX_CSS_PROP_ALIAS(color-scheme, colorScheme);
+    WEBXX_CSS_PROP_ALIAS(column-count, columnCount);
+    WEBXX_CSS_PROP_ALIAS(column-fill, columnFill);
+    WEBXX_CSS_PROP_ALIAS(column-gap, columnGap);
+    WEBXX_CSS_PROP_ALIAS(column-rule, columnRule);
+    WEBXX_CSS_PROP_ALIAS(column-rule-color, columnRuleColor);
+    WEBXX_CSS_PROP_ALIAS(column-rule-style, columnRuleStyle);
+    WEBXX_CSS_PROP_ALIAS(column-rule-width, columnRuleWidth);
+    WEBXX_CSS_PROP_ALIAS(column-span, columnSpan);
+    WEBXX_CSS_PROP_ALIAS(column-width, columnWidth);
+    WEBXX_CSS_PROP(columns);
+    WEBXX_CSS_PROP(contain);
+    WEBXX_CSS_PROP_ALIAS(contain-intrinsic-block-size, containIntrinsicBlockSize);
+    WEBXX_CSS_PROP_ALIAS(contain-intrinsic-height, containIntrinsicHeight);
+    WEBXX_CSS_PROP_ALIAS(contain-intrinsic-inline-size, containIntrinsicInlineSize);
+    WEBXX_CSS_PROP_ALIAS(contain-intrinsic-size, containIntrinsicSize);
+    WEBXX_CSS_PROP_ALIAS(contain-intrinsic-width, containIntrinsicWidth);
+    WEBXX_CSS_PROP(container);
+    WEBXX_CSS_PROP_ALIAS(container-name, containerName);
+    WEBXX_CSS_PROP_ALIAS(container-type, containerType);
+    WEBXX_CSS_PROP(content);
+    WEBXX_CSS_PROP_ALIAS(content-visibility, contentVisibility);
+    WEBXX_CSS_PROP_ALIAS(continue, continue_);
+    WEBXX_CSS_PROP_ALIAS(counter-increment, counterIncrement);
+    WEBXX_CSS_PROP_ALIAS(counter-reset, counterReset);
+    WEBXX_CSS_PROP_ALIAS(counter-set, counterSet);
+    WEBXX_CSS_PROP(cue);
+    WEBXX_CSS_PROP_ALIAS(cue-after, cueAfter);
+    WEBXX_CSS_PROP_ALIAS(cue-before, cueBefore);
+    WEBXX_CSS_PROP(cursor);
+    WEBXX_CSS_PROP(direction);
+    WEBXX_CSS_PROP(display);
+    WEBXX_CSS_PROP_ALIAS(dominant-baseline, dominantBaseline);
+    WEBXX_CSS_PROP(elevation);
+    WEBXX_CSS_PROP_ALIAS(empty-cells, emptyCells);
+    WEBXX_CSS_PROP(filter);
+    WEBXX_CSS_PROP(flex);
+    WEBXX_CSS_PROP_ALIAS(flex-basis, flexBasis);
+    WEBXX_CSS_PROP_ALIAS(flex-direction, flexDirection);
+    WEBXX_CSS_PROP_ALIAS(flex-flow, flexFlow);
+    WEBXX_CSS_PROP_ALIAS(flex-grow, flexGrow);
+    WEBXX_CSS_PROP_ALIAS(flex-shrink, flexShrink);
+    WEBXX_CSS_PROP_ALIAS(flex-wrap, flexWrap);
+    WEBXX_CSS_PROP_ALIAS(float, float_);
+    WEBXX_CSS_PROP_ALIAS(flood-color, floodColor);
+    WEBXX_CSS_PROP_ALIAS(flood-opacity, floodOpacity);
+    WEBXX_CSS_PROP(flow);
+    WEBXX_CSS_PROP_ALIAS(flow-from, flowFrom);
+    WEBXX_CSS_PROP_ALIAS(flow-into, flowInto);
+    WEBXX_CSS_PROP(font);
+    WEBXX_CSS_PROP_ALIAS(font-family, fontFamily);
+    WEBXX_CSS_PROP_ALIAS(font-feature-settings, fontFeatureSettings);
+    WEBXX_CSS_PROP_ALIAS(font-kerning, fontKerning);
+    WEBXX_CSS_PROP_ALIAS(font-language-override, fontLanguageOverride);
+    WEBXX_CSS_PROP_ALIAS(font-optical-sizing, fontOpticalSizing);
+    WEBXX_CSS_PROP_ALIAS(font-palette, fontPalette);
+    WEBXX_CSS_PROP_ALIAS(font-size, fontSize);
+    WEBXX_CSS_PROP_ALIAS(font-size-adjust, fontSizeAdjust);
+    WEBXX_CSS_PROP_ALIAS(font-stretch, fontStretch);
+    WEBXX_CSS_PROP_ALIAS(font-style, fontStyle);
+    WEBXX_CSS_PROP_ALIAS(font-synthesis, fontSynthesis);
+    WEBXX_CSS_PROP_ALIAS(font-synthesis-small-caps, fontSynthesisSmallCaps);
+    WEBXX_CSS_PROP_ALIAS(font-synthesis-style, fontSynthesisStyle);
+    WEBXX_CSS_PROP_ALIAS(font-synthesis-weight, fontSynthesisWeight);
+    WEBXX_CSS_PROP_ALIAS(font-variant, fontVariant);
+    WEBXX_CSS_PROP_ALIAS(font-variant-alternates, fontVariantAlternates);
+    WEBXX_CSS_PROP_ALIAS(font-variant-caps, fontVariantCaps);
+    WEBXX_CSS_PROP_ALIAS(font-variant-east-asian, fontVariantEastAsian);
+    WEBXX_CSS_PROP_ALIAS(font-variant-emoji, fontVariantEmoji);
+    WEBXX_CSS_PROP_ALIAS(font-variant-ligatures, fontVariantLigatures);
+    WEBXX_CSS_PROP_ALIAS(font-variant-numeric, fontVariantNumeric);
+    WEBXX_CSS_PROP_ALIAS(font-variant-position, fontVariantPosition);
+    WEBXX_CSS_PROP_ALIAS(font-variation-settings, fontVariationSettings);
+    WEBXX_CSS_PROP_ALIAS(font-weight, fontWeight);
+    WEBXX_CSS_PROP_ALIAS(footnote-display, footnoteDisplay);
+    WEBXX_CSS_PROP_ALIAS(footnote-policy, footnotePolicy);
+    WEBXX_CSS_PROP_ALIAS(forced-color-adjust, forcedColorAdjust);
+    WEBXX_CSS_PROP(gap);
+    WEBXX_CSS_PROP_ALIAS(glyph-orientation-vertical, glyphOrientationVertical);
+    WEBXX_CSS_PROP(grid);
+    WEBXX_CSS_PROP_ALIAS(grid-area, gridArea);
+    WEBXX_CSS_PROP_ALIAS(grid-auto-columns, gridAutoColumns);
+    WEBXX_CSS_PROP_ALIAS(grid-auto-flow, gridAutoFlow);
+    WEBXX_CSS_PROP_ALIAS(grid-auto-rows, gridAutoRows);
+    WEBXX_CSS_PROP_ALIAS(grid-column, gridColumn);
+    WEBXX_CSS_PROP_ALIAS(grid-column-end, gridColumnEnd);
+    WEBXX_CSS_PROP_ALIAS(grid-column-start, gridColumnStart);
+    WEBXX_CSS_PROP_ALIAS(grid-row, gridRow);
+    WEBXX_CSS_PROP_ALIAS(grid-row-end, gridRowEnd);
+    WEBXX_CSS_PROP_ALIAS(grid-row-start, gridRowStart);
+    WEBXX_CSS_PROP_ALIAS(grid-template, gridTemplate);
+    WEBXX_CSS_PROP_ALIAS(grid-template-areas, gridTemplateAreas);
+    WEBXX_CSS_PROP_ALIAS(grid-template-columns, gridTemplateColumns);
+    WEBXX_CSS_PROP_ALIAS(grid-template-rows, gridTemplateRows);
+    WEBXX_CSS_PROP_ALIAS(hanging-punctuation, hangingPunctuation);
+    WEBXX_CSS_PROP(height);
+    WEBXX_CSS_PROP_ALIAS(hyphenate-character, hyphenateCharacter);
+    WEBXX_CSS_PROP_ALIAS(hyphenate-limit-chars, hyphenateLimitChars);
+    WEBXX_CSS_PROP_ALIAS(hyphenate-limit-last, hyphenateLimitLast);
+    WEBXX_CSS_PROP_ALIAS(hyphenate-limit-lines, hyphenateLimitLines);
+    WEBXX_CSS_PROP_ALIAS(hyphenate-limit-zone, hyphenateLimitZone);
+    WEBXX_CSS_PROP(hyphens);
+    WEBXX_CSS_PROP_ALIAS(image-orientation, imageOrientation);
+    WEBXX_CSS_PROP_ALIAS(image-rendering, imageRendering);
+    WEBXX_CSS_PROP_ALIAS(image-resolution, imageResolution);
+    WEBXX_CSS_PROP_ALIAS(initial-letter, initialLetter);
+    WEBXX_CSS_PROP_ALIAS(initial-letter-align, initialLetterAlign);
+    WEBXX_CSS_PROP_ALIAS(initial-letter-wrap, initialLetterWrap);
+    WEBXX_CSS_PROP_ALIAS(inline-size, inlineSize);
+    WEBXX_CSS_PROP_ALIAS(inline-sizing, inlineSizing);
+    WEBXX_CSS_PROP(inset);
+    WEBXX_CSS_PROP_ALIAS(inset-block, insetBlock);
+    WEBXX_CSS_PROP_ALIAS(inset-block-end, insetBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(inset-block-start, insetBlockStart);
+    WEBXX_CSS_PROP_ALIAS(inset-inline, insetInline);
+    WEBXX_CSS_PROP_ALIAS(inset-inline-end, insetInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(inset-inline-start, insetInlineStart);
+    WEBXX_CSS_PROP(isolation);
+    WEBXX_CSS_PROP_ALIAS(justify-content, justifyContent);
+    WEBXX_CSS_PROP_ALIAS(justify-items, justifyItems);
+    WEBXX_CSS_PROP_ALIAS(justify-self, justifySelf);
+    WEBXX_CSS_PROP_ALIAS(leading-trim, leadingTrim);
+    WEBXX_CSS_PROP(left);
+    WEBXX_CSS_PROP_ALIAS(letter-spacing, letterSpacing);
+    WEBXX_CSS_PROP_ALIAS(lighting-color, lightingColor);
+    WEBXX_CSS_PROP_ALIAS(line-break, lineBreak);
+    WEBXX_CSS_PROP_ALIAS(line-clamp, lineClamp);
+    WEBXX_CSS_PROP_ALIAS(line-grid, lineGrid);
+    WEBXX_CSS_PROP_ALIAS(line-height, lineHeight);
+    WEBXX_CSS_PROP_ALIAS(line-padding, linePadding);
+    WEBXX_CSS_PROP_ALIAS(line-snap, lineSnap);
+    WEBXX_CSS_PROP_ALIAS(list-style, listStyle);
+    WEBXX_CSS_PROP_ALIAS(list-style-image, listStyleImage);
+    WEBXX_CSS_PROP_ALIAS(list-style-position, listStylePosition);
+    WEBXX_CSS_PROP_ALIAS(list-style-type, listStyleType);
+    WEBXX_CSS_PROP(margin);
+    WEBXX_CSS_PROP_ALIAS(margin-block, marginBlock);
+    WEBXX_CSS_PROP_ALIAS(margin-block-end, marginBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(margin-block-start, marginBlockStart);
+    WEBXX_CSS_PROP_ALIAS(margin-bottom, marginBottom);
+    WEBXX_CSS_PROP_ALIAS(margin-inline, marginInline);
+    WEBXX_CSS_PROP_ALIAS(margin-inline-end, marginInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(margin-inline-start, marginInlineStart);
+    WEBXX_CSS_PROP_ALIAS(margin-left, marginLeft);
+    WEBXX_CSS_PROP_ALIAS(margin-right, marginRight);
+    WEBXX_CSS_PROP_ALIAS(margin-top, marginTop);
+    WEBXX_CSS_PROP_ALIAS(margin-trim, marginTrim);
+    WEBXX_CSS_PROP_ALIAS(marker-side, markerSide);
+    WEBXX_CSS_PROP(mask);
+    WEBXX_CSS_PROP_ALIAS(mask-border, maskBorder);
+    WEBXX_CSS_PROP_ALIAS(mask-border-mode, maskBorderMode);
+    WEBXX_CSS_PROP_ALIAS(mask-border-outset, maskBorderOutset);
+    WEBXX_CSS_PROP_ALIAS(mask-border-repeat, maskBorderRepeat);
+    WEBXX_CSS_PROP_ALIAS(mask-border-slice, maskBorderSlice);
+    WEBXX_CSS_PROP_ALIAS(mask-border-source, maskBorderSource);
+    WEBXX_CSS_PROP_ALIAS(mask-border-width, maskBorderWidth);
+    WEBXX_CSS_PROP_ALIAS(mask-clip, maskClip);
+    WEBXX_CSS_PROP_ALIAS(mask-composite, maskComposite);
+    WEBXX_CSS_PROP_ALIAS(mask-image, maskImage);
+    WEBXX_CSS_PROP_ALIAS(mask-mode, maskMode);
+    WEBXX_CSS_PROP_ALIAS(mask-origin, maskOrigin);
+    WEBXX_CSS_PROP_ALIAS(mask-position, maskPosition);
+    WEBXX_CSS_PROP_ALIAS(mask-repeat, maskRepeat);
+    WEBXX_CSS_PROP_ALIAS(mask-size, maskSize);
+    WEBXX_CSS_PROP_ALIAS(mask-type, maskType);
+    WEBXX_CSS_PROP_ALIAS(max-block-size, maxBlockSize);
+    WEBXX_CSS_PROP_ALIAS(max-height, maxHeight);
+    WEBXX_CSS_PROP_ALIAS(max-inline-size, maxInlineSize);
+    WEBXX_CSS_PROP_ALIAS(max-lines, maxLines);
+    WEBXX_CSS_PROP_ALIAS(max-width, maxWidth);
+    WEBXX_CSS_PROP_ALIAS(min-block-size, minBlockSize);
+    WEBXX_CSS_PROP_ALIAS(min-height, minHeight);
+    WEBXX_CSS_PROP_ALIAS(min-inline-size, minInlineSize);
+    WEBXX_CSS_PROP_ALIAS(min-intrinsic-sizing, minIntrinsicSizing);
+    WEBXX_CSS_PROP_ALIAS(min-width, minWidth);
+    WEBXX_CSS_PROP_ALIAS(mix-blend-mode, mixBlendMode);
+    WEBXX_CSS_PROP_ALIAS(nav-down, navDown);
+    WEBXX_CSS_PROP_ALIAS(nav-left, navLeft);
+    WEBXX_CSS_PROP_ALIAS(nav-right, navRight);
+    WEBXX_CSS_PROP_ALIAS(nav-up, navUp);
+    WEBXX_CSS_PROP_ALIAS(object-fit, objectFit);
+    WEBXX_CSS_PROP_ALIAS(object-position, objectPosition);
+    WEBXX_CSS_PROP(offset);
+    WEBXX_CSS_PROP_ALIAS(offset-anchor, offsetAnchor);
+    WEBXX_CSS_PROP_ALIAS(offset-distance, offsetDistance);
+    WEBXX_CSS_PROP_ALIAS(offset-path, offsetPath);
+    WEBXX_CSS_PROP_ALIAS(offset-position, offsetPosition);
+    WEBXX_CSS_PROP_ALIAS(offset-rotate, offsetRotate);
+    WEBXX_CSS_PROP(opacity);
+    WEBXX_CSS_PROP(order);
+    WEBXX_CSS_PROP(orphans);
+    WEBXX_CSS_PROP(outline);
+    WEBXX_CSS_PROP_ALIAS(outline-color, outlineColor);
+    WEBXX_CSS_PROP_ALIAS(outline-offset, outlineOffset);
+    WEBXX_CSS_PROP_ALIAS(outline-style, outlineStyle);
+    WEBXX_CSS_PROP_ALIAS(outline-width, outlineWidth);
+    WEBXX_CSS_PROP(overflow);
+    WEBXX_CSS_PROP_ALIAS(overflow-anchor, overflowAnchor);
+    WEBXX_CSS_PROP_ALIAS(overflow-block, overflowBlock);
+    WEBXX_CSS_PROP_ALIAS(overflow-clip-margin, overflowClipMargin);
+    WEBXX_CSS_PROP_ALIAS(overflow-inline, overflowInline);
+    WEBXX_CSS_PROP_ALIAS(overflow-wrap, overflowWrap);
+    WEBXX_CSS_PROP_ALIAS(overflow-x, overflowX);
+    WEBXX_CSS_PROP_ALIAS(overflow-y, overflowY);
+    WEBXX_CSS_PROP(padding);
+    WEBXX_CSS_PROP_ALIAS(padding-block, paddingBlock);
+    WEBXX_CSS_PROP_ALIAS(padding-block-end, paddingBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(padding-block-start, paddingBlockStart);
+    WEBXX_CSS_PROP_ALIAS(padding-bottom, paddingBottom);
+    WEBXX_CSS_PROP_ALIAS(padding-inline, paddingInline);
+    WEBXX_CSS_PROP_ALIAS(padding-inline-end, paddingInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(padding-inline-start, paddingInlineStart);
+    WEBXX_CSS_PROP_ALIAS(padding-left, paddingLeft);
+    WEBXX_CSS_PROP_ALIAS(padding-right, paddingRight);
+    WEBXX_CSS_PROP_ALIAS(padding-top, paddingTop);
+    WEBXX_CSS_PROP(page);
+    WEBXX_CSS_PROP_ALIAS(page-break-after, pageBreakAfter);
+    WEBXX_CSS_PROP_ALIAS(page-break-before, pageBreakBefore);
+    WEBXX_CSS_PROP_ALIAS(page-break-inside, pageBreakInside);
+    WEBXX_CSS_PROP(pause);
+    WEBXX_CSS_PROP_ALIAS(pause-after, pauseAfter);
+    WEBXX_CSS_PROP_ALIAS(pause-before, pauseBefore);
+    WEBXX_CSS_PROP(perspective);
+    WEBXX_CSS_PROP_ALIAS(perspective-origin, perspectiveOrigin);
+    WEBXX_CSS_PROP(pitch);
+    WEBXX_CSS_PROP_ALIAS(pitch-range, pitchRange);
+    WEBXX_CSS_PROP_ALIAS(place-content, placeContent);
+    WEBXX_CSS_PROP_ALIAS(place-items, placeItems);
+    WEBXX_CSS_PROP_ALIAS(place-self, placeSelf);
+    WEBXX_CSS_PROP_ALIAS(play-during, playDuring);
+    WEBXX_CSS_PROP_ALIAS(pointer-events, pointerEvents);
+    WEBXX_CSS_PROP(position);
+    WEBXX_CSS_PROP_ALIAS(print-color-adjust, printColorAdjust);
+    WEBXX_CSS_PROP(quotes);
+    WEBXX_CSS_PROP_ALIAS(region-fragment, regionFragment);
+    WEBXX_CSS_PROP(resize);
+    WEBXX_CSS_PROP(rest);
+    WEBXX_CSS_PROP_ALIAS(rest-after, restAfter);
+    WEBXX_CSS_PROP_ALIAS(rest-before, restBefore);
+    WEBXX_CSS_PROP(richness);
+    WEBXX_CSS_PROP(right);
+    WEBXX_CSS_PROP(rotate);
+    WEBXX_CSS_PROP_ALIAS(row-gap, rowGap);
+    WEBXX_CSS_PROP_ALIAS(ruby-align, rubyAlign);
+    WEBXX_CSS_PROP_ALIAS(ruby-merge, rubyMerge);
+    WEBXX_CSS_PROP_ALIAS(ruby-overhang, rubyOverhang);
+    WEBXX_CSS_PROP_ALIAS(ruby-position, rubyPosition);
+    WEBXX_CSS_PROP(running);
+    WEBXX_CSS_PROP(scale);
+    WEBXX_CSS_PROP_ALIAS(scroll-behavior, scrollBehavior);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin, scrollMargin);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-block, scrollMarginBlock);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-block-end, scrollMarginBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-block-start, scrollMarginBlockStart);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-bottom, scrollMarginBottom);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-inline, scrollMarginInline);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-inline-end, scrollMarginInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-inline-start, scrollMarginInlineStart);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-left, scrollMarginLeft);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-right, scrollMarginRight);
+    WEBXX_CSS_PROP_ALIAS(scroll-margin-top, scrollMarginTop);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding, scrollPadding);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-block, scrollPaddingBlock);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-block-end, scrollPaddingBlockEnd);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-block-start, scrollPaddingBlockStart);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-bottom, scrollPaddingBottom);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-inline, scrollPaddingInline);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-inline-end, scrollPaddingInlineEnd);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-inline-start, scrollPaddingInlineStart);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-left, scrollPaddingLeft);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-right, scrollPaddingRight);
+    WEBXX_CSS_PROP_ALIAS(scroll-padding-top, scrollPaddingTop);
+    WEBXX_CSS_PROP_ALIAS(scroll-snap-align, scrollSnapAlign);
+    WEBXX_CSS_PROP_ALIAS(scroll-snap-stop, scrollSnapStop);
+    WEBXX_CSS_PROP_ALIAS(scroll-snap-type, scrollSnapType);
+    WEBXX_CSS_PROP_ALIAS(scrollbar-color, scrollbarColor);
+    WEBXX_CSS_PROP_ALIAS(scrollbar-gutter, scrollbarGutter);
+    WEBXX_CSS_PROP_ALIAS(scrollbar-width, scrollbarWidth);
+    WEBXX_CSS_PROP_ALIAS(shape-image-threshold, shapeImageThreshold);
+    WEBXX_CSS_PROP_ALIAS(shape-inside, shapeInside);
+    WEBXX_CSS_PROP_ALIAS(shape-margin, shapeMargin);
+    WEBXX_CSS_PROP_ALIAS(shape-outside, shapeOutside);
+    WEBXX_CSS_PROP_ALIAS(spatial-navigation-action, spatialNavigationAction);
+    WEBXX_CSS_PROP_ALIAS(spatial-navigation-contain, spatialNavigationContain);
+    WEBXX_CSS_PROP_ALIAS(spatial-navigation-function, spatialNavigationFunction);
+    WEBXX_CSS_PROP(speak);
+    WEBXX_CSS_PROP_ALIAS(speak-as, speakAs);
+    WEBXX_CSS_PROP_ALIAS(speak-header, speakHeader);
+    WEBXX_CSS_PROP_ALIAS(speak-numeral, speakNumeral);
+    WEBXX_CSS_PROP_ALIAS(speak-punctuation, speakPunctuation);
+    WEBXX_CSS_PROP_ALIAS(speech-rate, speechRate);
+    WEBXX_CSS_PROP(src);
+    WEBXX_CSS_PROP(stress);
+    WEBXX_CSS_PROP_ALIAS(string-set, stringSet);
+    WEBXX_CSS_PROP_ALIAS(tab-size, tabSize);
+    WEBXX_CSS_PROP_ALIAS(table-layout, tableLayout);
+    WEBXX_CSS_PROP_ALIAS(text-align, textAlign);
+    WEBXX_CSS_PROP_ALIAS(text-align-all, textAlignAll);
+    WEBXX_CSS_PROP_ALIAS(text-align-last, textAlignLast);
+    WEBXX_CSS_PROP_ALIAS(text-combine-upright, textCombineUpright);
+    WEBXX_CSS_PROP_ALIAS(text-decoration, textDecoration);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-color, textDecorationColor);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-line, textDecorationLine);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip, textDecorationSkip);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip-box, textDecorationSkipBox);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip-ink, textDecorationSkipInk);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip-inset, textDecorationSkipInset);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip-self, textDecorationSkipSelf);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-skip-spaces, textDecorationSkipSpaces);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-style, textDecorationStyle);
+    WEBXX_CSS_PROP_ALIAS(text-decoration-thickness, textDecorationThickness);
+    WEBXX_CSS_PROP_ALIAS(text-edge, textEdge);
+    WEBXX_CSS_PROP_ALIAS(text-emphasis, textEmphasis);
+    WEBXX_CSS_PROP_ALIAS(text-emphasis-color, textEmphasisColor);
+    WEBXX_CSS_PROP_ALIAS(text-emphasis-position, textEmphasisPosition);
+    WEBXX_CSS_PROP_ALIAS(text-emphasis-skip, textEmphasisSkip);
+    WEBXX_CSS_PROP_ALIAS(text-emphasis-style, textEmphasisStyle);
+    WEBXX_CSS_PROP_ALIAS(text-group-align, textGroupAlign);
+    WEBXX_CSS_PROP_ALIAS(text-indent, textIndent);
+    WEBXX_CSS_PROP_ALIAS(text-justify, textJustify);
+    WEBXX_CSS_PROP_ALIAS(text-orientation, textOrientation);
+    WEBXX_CSS_PROP_ALIAS(text-overflow, textOverflow);
+    WEBXX_CSS_PROP_ALIAS(text-shadow, textShadow);
+    WEBXX_CSS_PROP_ALIAS(text-space-collapse, textSpaceCollapse);
+    WEBXX_CSS_PROP_ALIAS(text-space-trim, textSpaceTrim);
+    WEBXX_CSS_PROP_ALIAS(text-spacing, textSpacing);
+    WEBXX_CSS_PROP_ALIAS(text-transform, textTransform);
+    WEBXX_CSS_PROP_ALIAS(text-underline-offset, textUnderlineOffset);
+    WEBXX_CSS_PROP_ALIAS(text-underline-position, textUnderlinePosition);
+    WEBXX_CSS_PROP_ALIAS(text-wrap, textWrap);
+    WEBXX_CSS_PROP(top);
+    WEBXX_CSS_PROP(transform);
+    WEBXX_CSS_PROP_ALIAS(transform-box, transformBox);
+    WEBXX_CSS_PROP_ALIAS(transform-origin, transformOrigin);
+    WEBXX_CSS_PROP_ALIAS(transform-style, transformStyle);
+    WEBXX_CSS_PROP(transition);
+    WEBXX_CSS_PROP_ALIAS(transition-delay, transitionDelay);
+    WEBXX_CSS_PROP_ALIAS(transition-duration, transitionDuration);
+    WEBXX_CSS_PROP_ALIAS(transition-property, transitionProperty);
+    WEBXX_CSS_PROP_ALIAS(transition-timing-function, transitionTimingFunction);
+    WEBXX_CSS_PROP(translate);
+    WEBXX_CSS_PROP_ALIAS(unicode-bidi, unicodeBidi);
+    WEBXX_CSS_PROP_ALIAS(user-select, userSelect);
+    WEBXX_CSS_PROP_ALIAS(vertical-align, verticalAlign);
+    WEBXX_CSS_PROP(visibility);
+    WEBXX_CSS_PROP_ALIAS(voice-balance, voiceBalance);
+    WEBXX_CSS_PROP_ALIAS(voice-duration, voiceDuration);
+    WEBXX_CSS_PROP_ALIAS(voice-family, voiceFamily);
+    WEBXX_CSS_PROP_ALIAS(voice-pitch, voicePitch);
+    WEBXX_CSS_PROP_ALIAS(voice-range, voiceRange);
+    WEBXX_CSS_PROP_ALIAS(voice-rate, voiceRate);
+    WEBXX_CSS_PROP_ALIAS(voice-stress, voiceStress);
+    WEBXX_CSS_PROP_ALIAS(voice-volume, voiceVolume);
+    WEBXX_CSS_PROP(volume);
+    WEBXX_CSS_PROP_ALIAS(white-space, whiteSpace);
+    WEBXX_CSS_PROP(widows);
+    WEBXX_CSS_PROP(width);
+    WEBXX_CSS_PROP_ALIAS(will-change, willChange);
+    WEBXX_CSS_PROP_ALIAS(word-boundary-detection, wordBoundaryDetection);
+    WEBXX_CSS_PROP_ALIAS(word-boundary-expansion, wordBoundaryExpansion);
+    WEBXX_CSS_PROP_ALIAS(word-break, wordBreak);
+    WEBXX_CSS_PROP_ALIAS(word-spacing, wordSpacing);
+    WEBXX_CSS_PROP_ALIAS(word-wrap, wordWrap);
+    WEBXX_CSS_PROP_ALIAS(wrap-after, wrapAfter);
+    WEBXX_CSS_PROP_ALIAS(wrap-before, wrapBefore);
+    WEBXX_CSS_PROP_ALIAS(wrap-flow, wrapFlow);
+    WEBXX_CSS_PROP_ALIAS(wrap-inside, wrapInside);
+    WEBXX_CSS_PROP_ALIAS(wrap-through, wrapThrough);
+    WEBXX_CSS_PROP_ALIAS(writing-mode, writingMode);
+    WEBXX_CSS_PROP_ALIAS(z-index, zIndex);
+}
+
+#endif // WEBXX_CSS_PROPERTIES_H
@@ -0,0 +1,150 @@
+#ifndef WEBXX_HTML_ATTRIBUTES_H
+#define WEBXX_HTML_ATTRIBUTES_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// HTML element attributes (e.g. _class).
+
+#include "core.h"
+
+
+////|          |////
+////|  Public  |////
+////|          |////
+
+
+WEBXX_EXPORT namespace Webxx {
+    // HTML element attributes:
+    WEBXX_HTML_STANDARD_ATTR(accept);
+    WEBXX_HTML_STANDARD_ATTR_ALIAS(accept-charset,acceptCharset);
+    WEBXX_HTML_STANDARD_ATTR(accesskey);
+    WEBXX_HTML_STANDARD_ATTR(action);
+    WEBXX_HTML_STANDARD_ATTR(align);
+    WEBXX_HTML_STANDARD_ATTR(allow);
+    WEBXX_HTML_STANDARD_ATTR(alt);
+    WEBXX_HTML_STANDARD_ATTR(as);
+    WEBXX_HTML_STANDARD_ATTR(async);
+    WEBXX_HTML_STANDARD_ATTR(autocapitalize);
+    WEBXX_HTML_STANDARD_ATTR(autocomplete);
+    WEBXX_HTML_STANDARD_ATTR(autocorrect);
+    WEBXX_HTML_STANDARD_ATTR(autofill);
+    WEBXX_HTML_STANDARD_ATTR(autofocus);
+    WEBXX_HTML_STANDARD_ATTR(autoplay);
+    WEBXX_HTML_STANDARD_ATTR(blocking);
+    WEBXX_HTML_STANDARD_ATTR(buffered);
+    WEBXX_HTML_STANDARD_ATTR(capture);
+    WEBXX_HTML_STANDARD_ATTR(challenge);
+    WEBXX_HTML_STANDARD_ATTR(charset);
+    WEBXX_HTML_STANDARD_ATTR(checked);
+    WEBXX_HTML_STANDARD_ATTR(cite);
+    WEBXX_HTML_STANDARD_ATTR(class);
+    WEBXX_HTML_STANDARD_ATTR(code);
+    WEBXX_HTML_STANDARD_ATTR(codebase);
+    WEBXX_HTML_STANDARD_ATTR(cols);
+    WEBXX_HTML_STANDARD_ATTR(colspan);
+    WEBXX_HTML_STANDARD_ATTR(content);
+    WEBXX_HTML_STANDARD_ATTR(contenteditable);
+    WEBXX_HTML_STANDARD_ATTR(contextmenu);
+    WEBXX_HTML_STANDARD_ATTR(controls);
+    WEBXX_HTML_STANDARD_ATTR(coords);
+    WEBXX_HTML_STANDARD_ATTR(crossorigin);
+    WEBXX_HTML_STANDARD_ATTR(csp);
+    WEBXX_HTML_STANDARD_ATTR(data);
+    WEBXX_HTML_STANDARD_ATTR(datetime);
+    WEBXX_HTML_STANDARD_ATTR(decoding);
+    WEBXX_HTML_STANDARD_ATTR(default);
+    WEBXX_HTML_STANDARD_ATTR(defer);
+    WEBXX_HTML_STANDARD_ATTR(dir);
+    WEBXX_HTML_STANDARD_ATTR(dirname);
+    WEBXX_HTML_STANDARD_ATTR(disabled);
+    WEBXX_HTML_STANDARD_ATTR(download);
+    WEBXX_HTML_STANDARD_ATTR(draggable);
+    WEBXX_HTML_STANDARD_ATTR(enctype);
+    WEBXX_HTML_STANDARD_ATTR(enterkeyhint);
+    WEBXX_HTML_STANDARD_ATTR(for);
+    WEBXX_HTML_STANDARD_ATTR(form);
+    WEBXX_HTML_STANDARD_ATTR(formaction);
+    WEBXX_HTML_STANDARD_ATTR(formenctype);
+    WEBXX_HTML_STANDARD_ATTR(formmethod);
+    WEBXX_HTML_STANDARD_ATTR(formnovalidate);
+    WEBXX_HTML_STANDARD_ATTR(formtarget);
+    WEBXX_HTML_STANDARD_ATTR(headers);
+    WEBXX_HTML_STANDARD_ATTR(height);
+    WEBXX_HTML_STANDARD_ATTR(hidden);
+    WEBXX_HTML_STANDARD_ATTR(high);
+    WEBXX_HTML_STANDARD_ATTR(href);
+    WEBXX_HTML_STANDARD_ATTR(hreflang);
+    WEBXX_HTML_STANDARD_ATTR_ALIAS(http-equiv, httpEquiv);
+    WEBXX_HTML_STANDARD_ATTR(icon);
+    WEBXX_HTML_STANDARD_ATTR(id);
+    WEBXX_HTML_STANDARD_ATTR(importance);
+    WEBXX_HTML_STANDARD_ATTR(integrity);
+    WEBXX_HTML_STANDARD_ATTR(inputmode);
+    WEBXX_HTML_STANDARD_ATTR(ismap);
+    WEBXX_HTML_STANDARD_ATTR(itemprop);
+    WEBXX_HTML_STANDARD_ATTR(keytype);
+    WEBXX_HTML_STANDARD_ATTR(kind);
+    WEBXX_HTML_STANDARD_ATTR(label);
+    WEBXX_HTML_STANDARD_ATTR(lang);
+    WEBXX_HTML_STANDARD_ATTR(loading);
+    WEBXX_HTML_STANDARD_ATTR(list);
+    WEBXX_HTML_STANDARD_ATTR(loop);
+    WEBXX_HTML_STANDARD_ATTR(low);
+    WEBXX_HTML_STANDARD_ATTR(max);
+    WEBXX_HTML_STANDARD_ATTR(maxlength);
+    WEBXX_HTML_STANDARD_ATTR(minlength);
+    WEBXX_HTML_STANDARD_ATTR(media);
+    WEBXX_HTML_STANDARD_ATTR(method);
+    WEBXX_HTML_STANDARD_ATTR(min);
+    WEBXX_HTML_STANDARD_ATTR(multiple);
+    WEBXX_HTML_STANDARD_ATTR(muted);
+    WEBXX_HTML_STANDARD_ATTR(name);
+    WEBXX_HTML_STANDARD_ATTR(novalidate);
+    WEBXX_HTML_STANDARD_ATTR(open);
+    WEBXX_HTML_STANDARD_ATTR(optimum);
+    WEBXX_HTML_STANDARD_ATTR(pattern);
+    WEBXX_HTML_STANDARD_ATTR(ping);
+    WEBXX_HTML_STANDARD_ATTR(placeholder);
+    WEBXX_HTML_STANDARD_ATTR(poster);
+    WEBXX_HTML_STANDARD_ATTR(preload);
+    WEBXX_HTML_STANDARD_ATTR(radiogroup);
+    WEBXX_HTML_STANDARD_ATTR(readonly);
+    WEBXX_HTML_STANDARD_ATTR(referrerpolicy);
+    WEBXX_HTML_STANDARD_ATTR(rel);
+    WEBXX_HTML_STANDARD_ATTR(required);
+    WEBXX_HTML_STANDARD_ATTR(reversed);
+    WEBXX_HTML_STANDARD_ATTR(role);
+    WEBXX_HTML_STANDARD_ATTR(rows);
+    WEBXX_HTML_STANDARD_ATTR(rowspan);
+    WEBXX_HTML_STANDARD_ATTR(sandbox);
+    WEBXX_HTML_STANDARD_ATTR(scope);
+    WEBXX_HTML_STANDARD_ATTR(selected);
+    WEBXX_HTML_STANDARD_ATTR(shape);
+    WEBXX_HTML_STANDARD_ATTR(size);
+    WEBXX_HTML_STANDARD_ATTR(sizes);
+    WEBXX_HTML_STANDARD_ATTR(slot);
+    WEBXX_HTML_STANDARD_ATTR(span);
+    WEBXX_HTML_STANDARD_ATTR(spellcheck);
+    WEBXX_HTML_STANDARD_ATTR(src);
+    WEBXX_HTML_STANDARD_ATTR(srcdoc);
+    WEBXX_HTML_STANDARD_ATTR(srclang);
+    WEBXX_HTML_STANDARD_ATTR(srcset);
+    WEBXX_HTML_STANDARD_ATTR(start);
+    WEBXX_HTML_STANDARD_ATTR(step);
+    WEBXX_HTML_STANDARD_ATTR(style);
+    WEBXX_HTML_STANDARD_ATTR(tabindex);
+    WEBXX_HTML_STANDARD_ATTR(target);
+    WEBXX_HTML_STANDARD_ATTR(title);
+    WEBXX_HTML_STANDARD_ATTR(translate);
+    WEBXX_HTML_STANDARD_ATTR(type);
+    WEBXX_HTML_STANDARD_ATTR(usemap);
+    WEBXX_HTML_STANDARD_ATTR(value);
+    WEBXX_HTML_STANDARD_ATTR(width);
+    WEBXX_HTML_STANDARD_ATTR(wrap);
+}
+
+#endif // WEBXX_HTML_ATTRIBUTES_H
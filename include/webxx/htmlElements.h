@@ -0,0 +1,137 @@
+#ifndef WEBXX_HTML_ELEMENTS_H
+#define WEBXX_HTML_ELEMENTS_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// HTML elements (e.g. dv).
+
+#include "core.h"
+
+
+////|          |////
+////|  Public  |////
+////|          |////
+
+
+WEBXX_EXPORT namespace Webxx {
+    // HTML elements:
+    WEBXX_HTML_STANDARD_EL(a);
+    WEBXX_HTML_STANDARD_EL(abbr);
+    WEBXX_HTML_STANDARD_EL(address);
+    WEBXX_HTML_STANDARD_EL(area);
+    WEBXX_HTML_STANDARD_EL(article);
+    WEBXX_HTML_STANDARD_EL(aside);
+    WEBXX_HTML_STANDARD_EL(audio);
+    WEBXX_HTML_STANDARD_EL(b);
+    WEBXX_HTML_STANDARD_EL(base);
+    WEBXX_HTML_STANDARD_EL(bdi);
+    WEBXX_HTML_STANDARD_EL(bdo);
+    WEBXX_HTML_STANDARD_EL(blockquote);
+    WEBXX_HTML_STANDARD_EL(body);
+    WEBXX_HTML_STANDARD_EL(br);
+    WEBXX_HTML_STANDARD_EL(button);
+    WEBXX_HTML_STANDARD_EL(canvas);
+    WEBXX_HTML_STANDARD_EL(caption);
+    WEBXX_HTML_STANDARD_EL(cite);
+    WEBXX_HTML_STANDARD_EL(code);
+    WEBXX_HTML_STANDARD_EL(col);
+    WEBXX_HTML_STANDARD_EL(colgroup);
+    WEBXX_HTML_STANDARD_EL(data);
+    WEBXX_HTML_STANDARD_EL(datalist);
+    WEBXX_HTML_STANDARD_EL(dd);
+    WEBXX_HTML_STANDARD_EL(del);
+    WEBXX_HTML_STANDARD_EL(details);
+    WEBXX_HTML_STANDARD_EL(dfn);
+    WEBXX_HTML_STANDARD_EL(dialog);
+    WEBXX_HTML_STANDARD_EL_ALIAS(div,dv);
+    WEBXX_HTML_STANDARD_EL(dl);
+    WEBXX_HTML_STANDARD_EL(dt);
+    WEBXX_HTML_STANDARD_EL(em);
+    WEBXX_HTML_STANDARD_EL(embed);
+    WEBXX_HTML_STANDARD_EL(fieldset);
+    WEBXX_HTML_STANDARD_EL(figcaption);
+    WEBXX_HTML_STANDARD_EL(figure);
+    WEBXX_HTML_STANDARD_EL(footer);
+    WEBXX_HTML_STANDARD_EL(form);
+    WEBXX_HTML_STANDARD_EL(h1);
+    WEBXX_HTML_STANDARD_EL(h2);
+    WEBXX_HTML_STANDARD_EL(h3);
+    WEBXX_HTML_STANDARD_EL(h4);
+    WEBXX_HTML_STANDARD_EL(h5);
+    WEBXX_HTML_STANDARD_EL(h6);
+    WEBXX_HTML_STANDARD_EL(head);
+    WEBXX_HTML_STANDARD_EL(header);
+    WEBXX_HTML_STANDARD_EL(hr);
+    WEBXX_HTML_STANDARD_EL(html);
+    WEBXX_HTML_STANDARD_EL(i);
+    WEBXX_HTML_STANDARD_EL(iframe);
+    WEBXX_HTML_STANDARD_EL(img);
+    WEBXX_HTML_STANDARD_EL(input);
+    WEBXX_HTML_STANDARD_EL(ins);
+    WEBXX_HTML_STANDARD_EL(kbd);
+    WEBXX_HTML_STANDARD_EL(label);
+    WEBXX_HTML_STANDARD_EL(legend);
+    WEBXX_HTML_STANDARD_EL(li);
+    WEBXX_HTML_STANDARD_EL(link);
+    WEBXX_HTML_STANDARD_EL(main);
+    WEBXX_HTML_STANDARD_EL(map);
+    WEBXX_HTML_STANDARD_EL(mark);
+    WEBXX_HTML_STANDARD_EL(math);
+    WEBXX_HTML_STANDARD_EL(menu);
+    WEBXX_HTML_STANDARD_EL(meta);
+    WEBXX_HTML_STANDARD_EL(meter);
+    WEBXX_HTML_STANDARD_EL(nav);
+    WEBXX_HTML_STANDARD_EL(noscript);
+    WEBXX_HTML_STANDARD_EL(object);
+    WEBXX_HTML_STANDARD_EL(ol);
+    WEBXX_HTML_STANDARD_EL(optgroup);
+    WEBXX_HTML_STANDARD_EL(option);
+    WEBXX_HTML_STANDARD_EL(output);
+    WEBXX_HTML_STANDARD_EL(p);
+    WEBXX_HTML_STANDARD_EL(picture);
+    WEBXX_HTML_STANDARD_EL(portal);
+    WEBXX_HTML_STANDARD_EL(pre);
+    WEBXX_HTML_STANDARD_EL(progress);
+    WEBXX_HTML_STANDARD_EL(q);
+    WEBXX_HTML_STANDARD_EL(rp);
+    WEBXX_HTML_STANDARD_EL(rt);
+    WEBXX_HTML_STANDARD_EL(ruby);
+    WEBXX_HTML_STANDARD_EL(s);
+    WEBXX_HTML_STANDARD_EL(samp);
+    WEBXX_HTML_STANDARD_EL(script);
+    WEBXX_HTML_STANDARD_EL(section);
+    WEBXX_HTML_STANDARD_EL(select);
+    WEBXX_HTML_STANDARD_EL(slot);
+    WEBXX_HTML_STANDARD_EL(small);
+    WEBXX_HTML_STANDARD_EL(source);
+    WEBXX_HTML_STANDARD_EL(span);
+    WEBXX_HTML_STANDARD_EL(strong);
+    // WEBXX_HTML_STANDARD_EL(style); Previously defined to accept CSS rules as children.
+    WEBXX_HTML_STANDARD_EL(sub);
+    WEBXX_HTML_STANDARD_EL(summary);
+    WEBXX_HTML_STANDARD_EL(sup);
+    WEBXX_HTML_STANDARD_EL(svg);
+    WEBXX_HTML_STANDARD_EL(table);
+    WEBXX_HTML_STANDARD_EL(tbody);
+    WEBXX_HTML_STANDARD_EL(td);
+    WEBXX_HTML_STANDARD_EL_ALIAS(template,template_);
+    WEBXX_HTML_STANDARD_EL(textarea);
+    WEBXX_HTML_STANDARD_EL(tfoot);
+    WEBXX_HTML_STANDARD_EL(th);
+    WEBXX_HTML_STANDARD_EL(thead);
+    WEBXX_HTML_STANDARD_EL(time);
+    WEBXX_HTML_STANDARD_EL(title);
+    WEBXX_HTML_STANDARD_EL(tr);
+    WEBXX_HTML_STANDARD_EL(track);
+    WEBXX_HTML_STANDARD_EL(u);
+    WEBXX_HTML_STANDARD_EL(ul);
+    WEBXX_HTML_STANDARD_EL(var);
+    WEBXX_HTML_STANDARD_EL(video);
+    WEBXX_HTML_STANDARD_EL(wbr);
+}
+
+#endif // WEBXX_HTML_ELEMENTS_H
@@ -0,0 +1,270 @@
+#ifndef WEBXX_UTILITY_H
+#define WEBXX_UTILITY_H
+
+//                _                  https://github.com/rthrfrd/webxx
+//  __      _____| |____  ___  __
+//  \ \ /\ / / _ | '_ \ \/ \ \/ /    MIT License
+//   \ V  V |  __| |_) >  < >  <     Copyright (c) 2022
+//    \_/\_/ \___|_.__/_/\_/_/\_\    Alexander Carver
+//
+// Utility: helpers for dynamically generating content (each, loop, maybe).
+
+#include <iterator>
+#include <type_traits>
+
+#include "core.h"
+
+
+////|           |////
+////|  Utility  |////
+////|           |////
+
+
+WEBXX_EXPORT namespace Webxx { namespace internal {
+
+    namespace exports {
+
+        template<class T, typename F>
+        fragment each (const T& items, F&& cb) {
+            std::vector<HtmlNode> tNodes;
+            tNodes.reserve(items.size());
+
+            for (const auto& item : items) {
+                tNodes.push_back(cb(item));
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<class T, typename F>
+        fragment each (T &&items, F&& cb) {
+            std::vector<HtmlNode>  tNodes;
+            tNodes.reserve(items.size());
+
+            for (auto&& item : items) {
+                tNodes.push_back(cb(std::forward<decltype(item)>(item)));
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<typename C, class T>
+        fragment each (const T& items) {
+            std::vector<HtmlNode>  tNodes;
+            tNodes.reserve(items.size());
+
+            for (const auto& item : items) {
+                tNodes.push_back(C{item});
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<typename C, class T, typename V = typename std::remove_reference<T>::type::value_type>
+        fragment each (T&& items) {
+            std::vector<HtmlNode> tNodes;
+            tNodes.reserve(items.size());
+
+            for (auto&& item : items) {
+                tNodes.push_back(C{std::forward<V>(item)});
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        struct Loop {
+            size_t index;
+            size_t count;
+        };
+
+        template<class T, typename F>
+        fragment loop (const T& items, F&& cb) {
+            std::vector<HtmlNode> tNodes;
+            tNodes.reserve(items.size());
+
+            Loop loop {0, items.size()};
+            for (const auto& item : items) {
+                tNodes.push_back(std::move(cb(item, loop)));
+                ++loop.index;
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<class T, typename F>
+        fragment loop (T&& items, F&& cb) {
+            std::vector<HtmlNode>  tNodes;
+            tNodes.reserve(items.size());
+
+            Loop loop {0, items.size()};
+            for (auto&& item : items) {
+                tNodes.push_back(std::move(cb(std::forward<decltype(item)>(item), loop)));
+                ++loop.index;
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<typename C, class T>
+        fragment loop (const T& items) {
+            std::vector<HtmlNode>  tNodes;
+            tNodes.reserve(items.size());
+
+            Loop loop {0, items.size()};
+            for (const auto& item : items) {
+                tNodes.push_back(C{item, loop});
+                ++loop.index;
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<typename C, class T, typename V = typename std::remove_reference<T>::type::value_type>
+        fragment loop (T&& items) {
+            std::vector<HtmlNode>  tNodes;
+            tNodes.reserve(items.size());
+
+            Loop loop {0, items.size()};
+            for (auto&& item : items) {
+                tNodes.push_back(C{std::forward<V>(item), loop});
+                ++loop.index;
+            }
+
+            return fragment{std::move(tNodes)};
+        }
+
+        template<typename T, typename F>
+        fragment maybe (T&& condition, F&& cb) {
+            if (condition) {
+                return fragment{{}, cb()};
+            }
+            return fragment{};
+        }
+
+        template<typename T, typename V, typename F>
+        fragment maybe (T&& condition, V&& forward, F&& cb) {
+            if (condition) {
+                return fragment{{}, cb(std::forward<V>(forward))};
+            }
+            return fragment{};
+        }
+
+        template<typename T, typename F>
+        HtmlAttribute maybeAttr (T&& condition, F&& attr) {
+            if (condition) {
+                return attr;
+            }
+            return HtmlAttribute{};
+        }
+    }
+
+    // Holds a range (by reference if it was given as an lvalue) & its callback:
+    template<class T, typename F>
+    struct LazyRange {
+        T items;
+        F cb;
+    };
+
+    template<class T>
+    using RangeIterator = decltype(std::begin(std::declval<T&>()));
+
+    template<class T>
+    inline constexpr bool isMultiPassRange = std::is_base_of<
+        std::forward_iterator_tag,
+        typename std::iterator_traits<RangeIterator<T>>::iterator_category
+    >::value;
+
+    template<class T, class = void>
+    struct HasSize : std::false_type {};
+    template<class T>
+    struct HasSize<T, std::void_t<decltype(std::declval<T&>().size())>> : std::true_type {};
+
+    // The number of items, or 0 if it can't be known without consuming the range:
+    template<class T>
+    std::size_t rangeSize (T& items) {
+        if constexpr (HasSize<T>::value) {
+            return items.size();
+        } else if constexpr (isMultiPassRange<T>) {
+            return static_cast<std::size_t>(std::distance(std::begin(items), std::end(items)));
+        } else {
+            return 0;
+        }
+    }
+
+    template<class T, typename F>
+    HtmlGeneratedNode generate (T&& items, F&& cb) {
+        typedef LazyRange<T, typename std::decay<F>::type> Range;
+        auto range = std::make_shared<Range>(Range{std::forward<T>(items), std::forward<F>(cb)});
+
+        return HtmlGeneratedNode{{
+            [range] () -> ContentCursor {
+                exports::Loop loop{0, rangeSize(range->items)};
+                return [range, loop, item = std::begin(range->items)] () mutable -> std::optional<HtmlNode> {
+                    if (item == std::end(range->items)) {
+                        return std::nullopt;
+                    }
+                    std::optional<HtmlNode> node{range->cb(*item, loop)};
+                    ++item;
+                    ++loop.index;
+                    return node;
+                };
+            },
+            isMultiPassRange<T>,
+            0,
+        }};
+    }
+
+    namespace exports {
+        // Like each & loop, but only produce each node as it is rendered:
+
+        template<class T, typename F>
+        HtmlGeneratedNode eachLazy (T&& items, F&& cb) {
+            return generate(std::forward<T>(items), [cb = std::forward<F>(cb)] (auto&& item, const Loop&) mutable {
+                return cb(std::forward<decltype(item)>(item));
+            });
+        }
+
+        template<typename C, class T>
+        HtmlGeneratedNode eachLazy (T&& items) {
+            return generate(std::forward<T>(items), [] (auto&& item, const Loop&) {
+                return C{std::forward<decltype(item)>(item)};
+            });
+        }
+
+        template<class T, typename F>
+        HtmlGeneratedNode loopLazy (T&& items, F&& cb) {
+            return generate(std::forward<T>(items), std::forward<F>(cb));
+        }
+
+        template<typename C, class T>
+        HtmlGeneratedNode loopLazy (T&& items) {
+            return generate(std::forward<T>(items), [] (auto&& item, const Loop& loop) {
+                return C{std::forward<decltype(item)>(item), loop};
+            });
+        }
+
+        // Render the rows returned by a generator (until it returns nullopt) a
+        // batch at a time, calling the flush function of the render options
+        // after each batch, so that memory use doesn't grow with the row count.
+        // Rows are only generated once, so their component CSS/head elements
+        // are not collected:
+        template<typename F>
+        HtmlGeneratedNode streamRows (const std::size_t batchSize, F&& generator) {
+            return HtmlGeneratedNode{{
+                [generator = std::forward<F>(generator)] () mutable -> ContentCursor {
+                    return [&generator, row = std::size_t{0}] () mutable -> std::optional<HtmlNode> {
+                        auto generated = generator(row++);
+                        if (!generated) {
+                            return std::nullopt;
+                        }
+                        return std::optional<HtmlNode>{std::move(*generated)};
+                    };
+                },
+                false,
+                std::max(batchSize, std::size_t{1}),
+            }};
+        }
+    }
+}}
+
+#endif // WEBXX_UTILITY_H
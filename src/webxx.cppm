@@ -0,0 +1,98 @@
+// C++20 named module exporting the Webxx namespace. Built by CMake when
+// WEBXX_MODULE=ON, after which `import webxx;` replaces `#include "webxx.h"`.
+module;
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#ifdef WEBXX_INSTRUMENT
+#include <chrono>
+#endif
+
+export module webxx;
+
+#define WEBXX_EXPORT export
+#include "webxx.h"
+
+// Exported using-directives aren't visible to importers on every compiler, so
+// the public names are re-declared in Webxx individually:
+export namespace Webxx {
+    using internal::exports::PlaceholderPopulator;
+    using internal::exports::PlaceholderWriter;
+    using internal::exports::PlaceholderWriterFn;
+    using internal::exports::PlaceholderValues;
+    using internal::exports::PlaceholderKey;
+    using internal::exports::placeholderKey;
+    using internal::exports::placeholderValues;
+    using internal::exports::catalog;
+    using internal::exports::_;
+    using internal::exports::property;
+    using internal::exports::rule;
+    using internal::exports::styles;
+    using internal::exports::prop;
+    using internal::exports::el;
+    using internal::exports::attr;
+    using internal::exports::node;
+    using internal::exports::nodes;
+    using internal::exports::children;
+    using internal::exports::attrs;
+    using internal::exports::doc;
+    using internal::exports::text;
+    using internal::exports::fragment;
+    using internal::exports::lazy;
+    using internal::exports::cached;
+    using internal::exports::fragmentCache;
+    using internal::exports::style;
+    using internal::exports::styleTarget;
+    using internal::exports::headTarget;
+    using internal::exports::headElements;
+    using internal::exports::scriptTarget;
+    using internal::exports::variables;
+    using internal::exports::variableTarget;
+    using internal::exports::collection;
+    using internal::exports::collectionTarget;
+    using internal::exports::component;
+    using internal::exports::contentHash;
+#ifdef WEBXX_INSTRUMENT
+    using internal::exports::renderStats;
+    using internal::exports::renderReport;
+    using internal::exports::renderObserver;
+#endif
+    using internal::exports::collect;
+    using internal::exports::render;
+    using internal::exports::HashedRender;
+    using internal::exports::renderHashed;
+    using internal::exports::renderHash;
+    using internal::exports::SinkStatus;
+    using internal::exports::ResumableRender;
+    using internal::exports::renderResumable;
+    using internal::exports::renderCss;
+    using internal::exports::each;
+    using internal::exports::Loop;
+    using internal::exports::loop;
+    using internal::exports::maybe;
+    using internal::exports::maybeAttr;
+    using internal::exports::eachLazy;
+    using internal::exports::loopLazy;
+    using internal::exports::streamRows;
+}
@@ -0,0 +1,3 @@
+// Translation unit for the webxx_pch target, whose precompiled webxx.h other
+// targets can share with `target_precompile_headers(... REUSE_FROM webxx_pch)`.
+#include "webxx.h"
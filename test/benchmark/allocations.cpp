@@ -0,0 +1,313 @@
+// Counts heap allocations made while rendering each scenario, and fails if
+// any scenario exceeds its budget, so that allocation regressions break ctest.
+#include "webxx.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+using namespace Webxx;
+
+
+////|                       |////
+////|  Counting allocator   |////
+////|                       |////
+
+
+namespace {
+    struct AllocationCounts {
+        std::size_t allocations{0};
+        std::size_t bytes{0};
+        std::size_t live{0};
+        std::size_t peak{0};
+    };
+
+    bool counting{false};
+    AllocationCounts counts{};
+
+    // Each allocation is prefixed with its size and offset from the raw pointer:
+    constexpr std::size_t headerSize{2 * sizeof(std::size_t)};
+
+    void* countedAlloc (std::size_t size, std::size_t align) {
+        align = std::max(align, alignof(std::max_align_t));
+        // Room for the header, and to round up to the alignment (which malloc only guarantees up to max_align_t):
+        unsigned char* raw = static_cast<unsigned char*>(std::malloc(size + headerSize + align));
+        if (!raw) {
+            throw std::bad_alloc();
+        }
+        const std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw) + headerSize;
+        const std::size_t offset = headerSize + (align - start % align) % align;
+        unsigned char* user = raw + offset;
+        std::size_t* header = reinterpret_cast<std::size_t*>(user) - 2;
+        header[0] = offset;
+        header[1] = size;
+
+        if (counting) {
+            ++counts.allocations;
+            counts.bytes += size;
+            counts.live += size;
+            counts.peak = std::max(counts.peak, counts.live);
+        }
+        return user;
+    }
+
+    void countedFree (void* ptr) noexcept {
+        if (!ptr) {
+            return;
+        }
+        unsigned char* user = static_cast<unsigned char*>(ptr);
+        std::size_t* header = reinterpret_cast<std::size_t*>(user) - 2;
+        if (counting) {
+            counts.live -= std::min(counts.live, header[1]);
+        }
+        std::free(user - header[0]);
+    }
+}
+
+void* operator new (std::size_t size) { return countedAlloc(size, 0); }
+void* operator new[] (std::size_t size) { return countedAlloc(size, 0); }
+void* operator new (std::size_t size, std::align_val_t align) { return countedAlloc(size, static_cast<std::size_t>(align)); }
+void* operator new[] (std::size_t size, std::align_val_t align) { return countedAlloc(size, static_cast<std::size_t>(align)); }
+void* operator new (std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAlloc(size, 0); } catch (...) { return nullptr; }
+}
+void* operator new[] (std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAlloc(size, 0); } catch (...) { return nullptr; }
+}
+void operator delete (void* ptr) noexcept { countedFree(ptr); }
+void operator delete[] (void* ptr) noexcept { countedFree(ptr); }
+void operator delete (void* ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete[] (void* ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete (void* ptr, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete[] (void* ptr, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete (void* ptr, std::size_t, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete[] (void* ptr, std::size_t, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete (void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+void operator delete[] (void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+
+
+////|             |////
+////|  Scenarios  |////
+////|             |////
+
+
+typedef const char* Input;
+constexpr static const char* helloWorld{"Hello world."};
+constexpr static const char* something{"something"};
+constexpr static const char* somethingElse{"Something else."};
+constexpr size_t nMany{1000};
+constexpr std::array<size_t,nMany> nItems{};
+
+std::string singleElement () {
+    return render(h1{helloWorld});
+}
+
+std::string multiElement () {
+    return render(dv{{_class{something}},
+        h1{helloWorld},
+        p{somethingElse},
+    });
+}
+
+std::string loop1k () {
+    return render(ol{
+        loop(nItems, [] (const auto&, const Loop& loop) {
+            return li{{_class{something}},
+                std::to_string(loop.index),
+                h1{helloWorld},
+                p{somethingElse},
+            };
+        }),
+    });
+}
+
+std::string loop1kLazy () {
+    return render(ol{
+        loopLazy(nItems, [] (const auto&, const Loop& loop) {
+            return li{{_class{something}},
+                std::to_string(loop.index),
+                h1{helloWorld},
+                p{somethingElse},
+            };
+        }),
+    });
+}
+
+// Rows are flushed (and discarded) every batch, so peak memory is independent of the row count:
+template<std::size_t ROWS>
+std::string streamed () {
+    return render(table{tbody{
+        streamRows(256, [] (std::size_t row) -> std::optional<tr> {
+            if (row == ROWS) {
+                return std::nullopt;
+            }
+            return tr{
+                td{std::to_string(row)},
+                td{helloWorld},
+                td{somethingElse},
+            };
+        }),
+    }}, {nullptr, internal::renderToInternalBuffer, 16 * 1024, [] (std::string& buffer) {
+        buffer.clear();
+    }});
+}
+
+struct Card : component<Card> {
+    Card (Input title) : component<Card> {
+        {
+            {".card", padding{"1em"}},
+            {".card h2", fontWeight{"bold"}},
+        },
+        dv{{_class{"card"}},
+            h2{title},
+            p{somethingElse},
+        },
+        {
+            link{{_rel{"preload"}, _href{"/card.png"}, _as{"image"}}},
+        },
+    } {}
+};
+
+std::string componentPage () {
+    return render(doc{
+        html{
+            head{
+                title{helloWorld},
+                styleTarget{},
+                headTarget{},
+            },
+            body{
+                each(nItems, [] (const auto&) { return Card{something}; }),
+            },
+        },
+    });
+}
+
+std::string placeholders () {
+    return render(ul{
+        each(nItems, [] (const auto&) {
+            return li{{_title{_{"tooltip"}}}, _{"label"}};
+        }),
+    }, {[] (const std::string_view& key, const std::string_view&) -> std::string_view {
+        return key == "label" ? somethingElse : something;
+    }});
+}
+
+std::string placeholderWriter () {
+    internal::RenderOptions options;
+    options.placeholderWriter = [] (const std::string_view& key, const std::string_view&, PlaceholderWriter& out) {
+        out << key << " (" << nItems.size() << ")";
+    };
+    return render(ul{
+        each(nItems, [] (const auto&) {
+            return li{{_title{_{"tooltip"}}}, _{"label"}};
+        }),
+    }, std::move(options));
+}
+
+std::string lazyBlocks () {
+    return render(dv{
+        each(nItems, [] (const auto&) {
+            return lazy{[] () { return p{helloWorld}; }};
+        }),
+    });
+}
+
+
+////|          |////
+////|  Runner  |////
+////|          |////
+
+
+struct Budget {
+    std::size_t allocations;
+    std::size_t bytes;
+    std::size_t peak;
+};
+
+struct Scenario {
+    const char* name;
+    std::string (*fn)();
+    Budget budget;
+};
+
+int main () {
+    // Budgets (allocations, bytes, peak live bytes) are ~15% above the counts
+    // measured with libstdc++ 12, to allow for other standard libraries:
+    const Scenario scenarios[] = {
+        {"singleElement", singleElement, {4, 19000, 19000}},
+        {"multiElement", multiElement, {7, 20000, 20000}},
+        {"loop1k", loop1k, {4600, 1360000, 1230000}},
+        {"loop1kLazy", loop1kLazy, {4600, 1210000, 240000}},
+        {"streamed10k", streamed<10000>, {46000, 8930000, 321000}},
+        {"streamed100k", streamed<100000>, {460000, 88500000, 321000}},
+        {"componentPage", componentPage, {17300, 3550000, 3200000}},
+        {"placeholders", placeholders, {2300, 590000, 530000}},
+        {"placeholderWriter", placeholderWriter, {2300, 580000, 525000}},
+        {"lazyBlocks", lazyBlocks, {3500, 600000, 575000}},
+    };
+    constexpr std::size_t iterations{10};
+
+    int failures{0};
+
+    // Over-aligned allocations must still honour their alignment:
+    struct alignas(64) CacheLine {
+        unsigned char bytes[64];
+    };
+    for (std::size_t i = 0; i < 8; ++i) {
+        std::unique_ptr<CacheLine> line{new CacheLine{}};
+        if (reinterpret_cast<std::uintptr_t>(line.get()) % alignof(CacheLine)) {
+            std::printf("Misaligned allocation of %zu bytes\n", sizeof(CacheLine));
+            ++failures;
+        }
+    }
+
+    // The size of each node drives the bytes (& peak) of every scenario:
+    std::printf("%-18s %14s\n", "Type", "Bytes");
+    std::printf("%-18s %14zu\n", "HtmlNode", sizeof(internal::HtmlNode));
+    std::printf("%-18s %14zu\n", "HtmlNodeExtra", sizeof(internal::HtmlNodeExtra));
+    std::printf("%-18s %14zu\n", "HtmlAttribute", sizeof(internal::HtmlAttribute));
+    std::printf("%-18s %14zu\n", "Text", sizeof(internal::Text));
+    std::printf("\n");
+
+    std::printf("%-18s %14s %14s %14s\n", "Scenario", "Allocs/iter", "Bytes/iter", "Peak bytes");
+    for (const auto& scenario : scenarios) {
+        // Warm up (e.g. function-local statics):
+        scenario.fn();
+
+        AllocationCounts total{};
+        std::size_t peak{0};
+        for (std::size_t i = 0; i < iterations; ++i) {
+            counts = {};
+            counting = true;
+            std::string output = scenario.fn();
+            counting = false;
+            total.allocations += counts.allocations;
+            total.bytes += counts.bytes;
+            peak = std::max(peak, counts.peak);
+        }
+
+        const AllocationCounts perIteration{total.allocations / iterations, total.bytes / iterations, 0, peak};
+        const bool overBudget = perIteration.allocations > scenario.budget.allocations
+            || perIteration.bytes > scenario.budget.bytes
+            || perIteration.peak > scenario.budget.peak;
+
+        std::printf("%-18s %14zu %14zu %14zu%s\n",
+            scenario.name,
+            perIteration.allocations,
+            perIteration.bytes,
+            perIteration.peak,
+            overBudget ? "  OVER BUDGET" : ""
+        );
+        if (overBudget) {
+            std::printf("%-18s %14zu %14zu %14zu  (budget)\n", "", scenario.budget.allocations, scenario.budget.bytes, scenario.budget.peak);
+            ++failures;
+        }
+    }
+
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -179,8 +179,8 @@ static void loop1kInja (benchmark::State& state) {
 }
 BENCHMARK(loop1kInja);
 
-std::string render1kElementWebxx (Input a, Input b, Input c) {
-    return render(ol{
+ol build1kElementWebxx (Input a, Input b, Input c) {
+    return ol{
         loop(nItems, [a,b,c] (const auto&, const Loop& loop) {
             return li{{_class{b}},
                 std::to_string(loop.index),
@@ -188,7 +188,11 @@ std::string render1kElementWebxx (Input a, Input b, Input c) {
                 p{c},
             };
         }),
-    });
+    };
+}
+
+std::string render1kElementWebxx (Input a, Input b, Input c) {
+    return render(build1kElementWebxx(a, b, c));
 }
 
 static void loop1kWebxx (benchmark::State& state) {
@@ -196,9 +200,20 @@ static void loop1kWebxx (benchmark::State& state) {
         benchmark::DoNotOptimize(render1kElementWebxx(helloWorld, something, somethingElse));
         benchmark::ClobberMemory();
     }
+    state.counters["sizeofNode"] = sizeof(internal::HtmlNode);
 }
 BENCHMARK(loop1kWebxx);
 
+// Building the tree alone, which is dominated by the size of each node:
+static void loop1kBuildWebxx (benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(build1kElementWebxx(helloWorld, something, somethingElse));
+        benchmark::ClobberMemory();
+    }
+    state.counters["sizeofNode"] = sizeof(internal::HtmlNode);
+}
+BENCHMARK(loop1kBuildWebxx);
+
 std::string render1kStringAppend (Input a, Input b, Input c) {
     std::string html;
 
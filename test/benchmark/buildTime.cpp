@@ -0,0 +1,63 @@
+// Compares how long a build of several webxx views takes when each TU parses
+// webxx.h itself, when they share a precompiled header, and (when enabled)
+// when they import the webxx module. One-off setup (building the PCH or the
+// module interface) is counted once, as it would be in a real build.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+struct Mode {
+    std::string name;
+    std::string setup;
+    std::string command;
+    std::string source;
+};
+
+static bool timed (const std::string& command, double& ms) {
+    const Clock::time_point start = Clock::now();
+    if (std::system(command.c_str()) != 0) {
+        std::fprintf(stderr, "Failed: %s\n", command.c_str());
+        return false;
+    }
+    ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    return true;
+}
+
+int main (int argc, char** argv) {
+    const int views = argc > 1 ? std::max(1, std::atoi(argv[1])) : 8;
+    const std::vector<Mode> modes{
+        {"include", "", WEBXX_BUILD_COMMAND, "webxx.cpp"},
+        {"pch", WEBXX_BUILD_PCH_SETUP, WEBXX_BUILD_PCH_COMMAND, "webxx.cpp"},
+#ifdef WEBXX_BUILD_MODULE_SETUP
+        {"module", WEBXX_BUILD_MODULE_SETUP, WEBXX_BUILD_MODULE_COMMAND, "module.cpp"},
+#endif
+    };
+
+    std::printf("%-10s %12s %12s %12s  (%d views)\n", "Mode", "Setup (ms)", "Per TU (ms)", "Total (ms)", views);
+    for (const auto& mode : modes) {
+        double setup{0};
+        if (!mode.setup.empty() && !timed(mode.setup, setup)) {
+            return EXIT_FAILURE;
+        }
+
+        double total{setup};
+        for (int i = 0; i < views; ++i) {
+            double ms{0};
+            const std::string command = mode.command
+                + " -o " WEBXX_BUILD_OUTPUT_DIR "/" + mode.name + std::to_string(i) + ".o"
+                + " " WEBXX_BUILD_SOURCE_DIR "/" + mode.source;
+            if (!timed(command, ms)) {
+                return EXIT_FAILURE;
+            }
+            total += ms;
+        }
+        std::printf("%-10s %12.1f %12.1f %12.1f\n", mode.name.c_str(), setup, (total - setup) / views, total);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+// Compares populating 500 placeholders in one of 20 locales by looking up
+// each key in a map, against using the slots of a compile time catalog.
+#include "benchmark/benchmark.h"
+#include "webxx.h"
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace Webxx;
+
+constexpr std::size_t keyCount{500};
+constexpr std::size_t localeCount{20};
+
+
+////|        |////
+////|  Keys  |////
+////|        |////
+
+
+// "item.000" to "item.499", generated at compile time:
+constexpr std::size_t keyLength{8};
+struct KeyChars {
+    char chars[keyCount * keyLength];
+};
+
+constexpr KeyChars makeKeyChars () {
+    KeyChars keyChars{};
+    for (std::size_t i = 0; i < keyCount; ++i) {
+        char* key = keyChars.chars + i * keyLength;
+        key[0] = 'i'; key[1] = 't'; key[2] = 'e'; key[3] = 'm'; key[4] = '.';
+        key[5] = static_cast<char>('0' + i / 100);
+        key[6] = static_cast<char>('0' + i / 10 % 10);
+        key[7] = static_cast<char>('0' + i % 10);
+    }
+    return keyChars;
+}
+inline constexpr KeyChars keyChars{makeKeyChars()};
+
+constexpr std::array<std::string_view, keyCount> makeKeys () {
+    std::array<std::string_view, keyCount> tKeys{};
+    for (std::size_t i = 0; i < keyCount; ++i) {
+        tKeys[i] = {keyChars.chars + i * keyLength, keyLength};
+    }
+    return tKeys;
+}
+inline constexpr std::array<std::string_view, keyCount> keys{makeKeys()};
+
+using Items = catalog<keys>;
+
+
+////|           |////
+////|  Locales  |////
+////|           |////
+
+
+// Each locale as the contents of a "key=value" file:
+static const std::vector<std::string>& localeFiles () {
+    static std::vector<std::string> files = [] () {
+        std::vector<std::string> tFiles;
+        for (std::size_t locale = 0; locale < localeCount; ++locale) {
+            std::string contents;
+            for (const auto& key : keys) {
+                contents.append(key).append("=Locale ").append(std::to_string(locale)).append(" ").append(key).append("\n");
+            }
+            tFiles.push_back(std::move(contents));
+        }
+        return tFiles;
+    }();
+    return files;
+}
+
+static const std::vector<std::unordered_map<std::string_view, std::string_view>>& localeMaps () {
+    static std::vector<std::unordered_map<std::string_view, std::string_view>> maps = [] () {
+        std::vector<std::unordered_map<std::string_view, std::string_view>> tMaps;
+        for (const auto& contents : localeFiles()) {
+            auto& map = tMaps.emplace_back();
+            std::size_t start = 0;
+            while (start < contents.size()) {
+                const std::size_t end = contents.find('\n', start);
+                const std::string_view line{contents.data() + start, end - start};
+                const std::size_t separator = line.find('=');
+                map.emplace(line.substr(0, separator), line.substr(separator + 1));
+                start = end + 1;
+            }
+        }
+        return tMaps;
+    }();
+    return maps;
+}
+
+static const std::vector<PlaceholderValues>& localeTables () {
+    static std::vector<PlaceholderValues> tables = [] () {
+        std::vector<PlaceholderValues> tTables;
+        for (const auto& contents : localeFiles()) {
+            tTables.push_back(Items::values(contents));
+        }
+        return tTables;
+    }();
+    return tables;
+}
+
+template<std::size_t... I>
+static std::array<PlaceholderKey, keyCount> catalogKeys (std::index_sequence<I...>) {
+    return {Items::key<I>()...};
+}
+
+
+////|              |////
+////|  Benchmarks  |////
+////|              |////
+
+
+template<typename F>
+static void renderLocales (benchmark::State& state, F&& renderLocale) {
+    std::size_t locale{0};
+    std::size_t bytes{0};
+    for (auto _ : state) {
+        std::string output = renderLocale(locale++ % localeCount);
+        bytes = output.size();
+        benchmark::DoNotOptimize(output);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+static void catalogPopulator (benchmark::State& state) {
+    const auto& maps = localeMaps();
+    renderLocales(state, [&maps] (std::size_t locale) {
+        const auto& map = maps[locale];
+        return render(ul{each(keys, [] (std::string_view key) {
+            return li{_{key}};
+        })}, {[&map] (const std::string_view& key, const std::string_view&) -> const std::string_view {
+            return map.at(key);
+        }});
+    });
+}
+BENCHMARK(catalogPopulator);
+
+static void catalogSlots (benchmark::State& state) {
+    const auto& tables = localeTables();
+    static const std::array<PlaceholderKey, keyCount> itemKeys = catalogKeys(std::make_index_sequence<keyCount>{});
+    renderLocales(state, [&tables] (std::size_t locale) {
+        internal::RenderOptions options;
+        options.placeholderValues = &tables[locale];
+        return render(ul{each(itemKeys, [] (const PlaceholderKey& key) {
+            return li{key};
+        })}, std::move(options));
+    });
+}
+BENCHMARK(catalogSlots);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,9 @@
+#include "webxx/catalog.h"
+
+inline constexpr std::string_view keys[] = {"a", "b"};
+
+std::string view () {
+    using namespace Webxx;
+    using Keys = catalog<keys>;
+    return render(fragment{Keys::key<Keys::index("b")>()});
+}
@@ -0,0 +1,6 @@
+#include "webxx/core.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(fragment{"Hello world."});
+}
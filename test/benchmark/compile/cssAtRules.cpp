@@ -0,0 +1,6 @@
+#include "webxx/cssAtRules.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(atImport{"print.css"});
+}
@@ -0,0 +1,6 @@
+#include "webxx/cssProperties.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(rule{".a", color{"red"}});
+}
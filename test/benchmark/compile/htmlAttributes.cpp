@@ -0,0 +1,6 @@
+#include "webxx/htmlAttributes.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(_class{"a"});
+}
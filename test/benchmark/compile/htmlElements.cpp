@@ -0,0 +1,6 @@
+#include "webxx/htmlElements.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(dv{h1{"Hello world."}});
+}
@@ -0,0 +1,7 @@
+#include <string>
+import webxx;
+
+std::string view () {
+    using namespace Webxx;
+    return render(dv{{_class{"a"}}, h1{"Hello world."}, style{{".a", color{"red"}}}});
+}
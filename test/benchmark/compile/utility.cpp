@@ -0,0 +1,6 @@
+#include "webxx/utility.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(each(std::vector<std::string>{"a", "b"}, [] (const std::string& x) { return x; }));
+}
@@ -0,0 +1,6 @@
+#include "webxx.h"
+
+std::string view () {
+    using namespace Webxx;
+    return render(dv{{_class{"a"}}, h1{"Hello world."}, style{{".a", color{"red"}}}});
+}
@@ -0,0 +1,48 @@
+// Measures how long a translation unit takes to compile when it includes
+// each of the webxx headers, by invoking the compiler on the sources in
+// compile/. The compiler & flags are baked in by CMake.
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+int main (int argc, char** argv) {
+    const int repetitions = argc > 1 ? std::max(1, std::atoi(argv[1])) : 3;
+    const std::vector<std::string> units{
+        "core",
+        "cssAtRules",
+        "cssProperties",
+        "htmlAttributes",
+        "htmlElements",
+        "utility",
+        "catalog",
+        "webxx",
+    };
+
+    std::printf("%-16s %12s %12s\n", "Header", "Best (ms)", "Mean (ms)");
+    for (const auto& unit : units) {
+        const std::string command = std::string{WEBXX_COMPILE_COMMAND}
+            + " -o " WEBXX_COMPILE_OUTPUT_DIR "/" + unit + ".o"
+            + " " WEBXX_COMPILE_SOURCE_DIR "/" + unit + ".cpp";
+
+        double best{0};
+        double total{0};
+        for (int i = 0; i < repetitions; ++i) {
+            const Clock::time_point start = Clock::now();
+            if (std::system(command.c_str()) != 0) {
+                std::fprintf(stderr, "Failed: %s\n", command.c_str());
+                return EXIT_FAILURE;
+            }
+            const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            best = i ? std::min(best, ms) : ms;
+            total += ms;
+        }
+        std::printf("%-16s %12.1f %12.1f\n", unit.c_str(), best, total / repetitions);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,63 @@
+#include "benchmark/benchmark.h"
+#include "corpus.h"
+
+template<typename F>
+static void renderCorpus (benchmark::State& state, F&& build, Webxx::PlaceholderPopulator populator = nullptr, const Webxx::PlaceholderValues* values = nullptr, std::size_t locale = 0, bool minify = false) {
+    std::size_t bytes{0};
+    for (auto _ : state) {
+        Webxx::internal::RenderOptions options{populator};
+        options.placeholderValues = values;
+        options.placeholderLocale = locale;
+        options.minify = minify;
+        std::string output = Webxx::render(build(), std::move(options));
+        bytes = output.size();
+        benchmark::DoNotOptimize(output);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["output"] = static_cast<double>(bytes);
+}
+
+static void corpusDataTable10k (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::dataTable(10000); });
+}
+BENCHMARK(corpusDataTable10k);
+
+static void corpusDataTable10kMinified (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::dataTable(10000); }, nullptr, nullptr, 0, true);
+}
+BENCHMARK(corpusDataTable10kMinified);
+
+static void corpusCommentThread200 (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::commentThread(200); });
+}
+BENCHMARK(corpusCommentThread200);
+
+static void corpusComponents50 (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::componentsPage(); });
+}
+BENCHMARK(corpusComponents50);
+
+static void corpusI18n500 (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::i18nPage(500); }, Corpus::i18nPopulator(500));
+}
+BENCHMARK(corpusI18n500);
+
+static void corpusI18n500Slots (benchmark::State& state) {
+    const Webxx::PlaceholderValues& values = Corpus::i18nValues(500);
+    renderCorpus(state, [] () { return Corpus::i18nKeyedPage(500); }, Corpus::i18nPopulator(500), &values);
+}
+BENCHMARK(corpusI18n500Slots);
+
+static void corpusI18n500Cached (benchmark::State& state) {
+    static Webxx::fragmentCache cache;
+    renderCorpus(state, [] () { return Corpus::i18nCachedPage(cache, 500); }, Corpus::i18nPopulator(500), nullptr, 1);
+}
+BENCHMARK(corpusI18n500Cached);
+
+static void corpusLazy1k (benchmark::State& state) {
+    renderCorpus(state, [] () { return Corpus::lazyPage(1000); });
+}
+BENCHMARK(corpusLazy1k);
+
+BENCHMARK_MAIN();
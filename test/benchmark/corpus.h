@@ -0,0 +1,328 @@
+#ifndef WEBXX_BENCHMARK_CORPUS_H
+#define WEBXX_BENCHMARK_CORPUS_H
+
+// Representative documents, shaped like real pages rather than micro cases.
+
+#include "webxx.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Corpus {
+    using namespace Webxx;
+
+    ////|              |////
+    ////|  Data table  |////
+    ////|              |////
+
+    struct Row {
+        std::size_t id;
+        std::string name;
+        std::string email;
+        std::string status;
+        double balance;
+    };
+
+    inline const std::vector<Row>& tableRows (std::size_t count) {
+        static std::unordered_map<std::size_t, std::vector<Row>> cache;
+        auto& rows = cache[count];
+        if (rows.empty()) {
+            rows.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                rows.push_back({
+                    i,
+                    "Customer " + std::to_string(i),
+                    "customer" + std::to_string(i) + "@example.com",
+                    i % 3 ? "active" : "suspended",
+                    static_cast<double>(i) * 1.25,
+                });
+            }
+        }
+        return rows;
+    }
+
+    inline doc dataTable (std::size_t count = 10000) {
+        return doc{
+            html{
+                head{title{"Customers"}},
+                body{
+                    table{{_class{"data"}},
+                        thead{
+                            tr{th{"#"}, th{"Name"}, th{"Email"}, th{"Status"}, th{"Balance"}},
+                        },
+                        tbody{
+                            each(tableRows(count), [] (const Row& row) {
+                                return tr{{_class{row.status}},
+                                    td{std::to_string(row.id)},
+                                    td{a{{_href{"/customers/" + std::to_string(row.id)}}, row.name}},
+                                    td{row.email},
+                                    td{{_class{"status"}}, row.status},
+                                    td{{_class{"num"}}, std::to_string(row.balance)},
+                                };
+                            }),
+                        },
+                    },
+                },
+            },
+        };
+    }
+
+
+    ////|                  |////
+    ////|  Comment thread  |////
+    ////|                  |////
+
+
+    inline node comment (std::size_t depth, std::size_t remaining) {
+        return dv{{_class{"comment"}, _id{"c" + std::to_string(depth)}},
+            header{
+                span{{_class{"author"}}, "user", std::to_string(depth)},
+                Webxx::time{{_datetime{"2022-11-01T12:00:00Z"}}, "1 day ago"},
+            },
+            p{"I have some thoughts on the previous comment, which are as follows."},
+            remaining ? comment(depth + 1, remaining - 1) : node{},
+        };
+    }
+
+    inline doc commentThread (std::size_t depth = 200) {
+        return doc{
+            html{
+                head{title{"Thread"}},
+                body{
+                    section{{_class{"thread"}},
+                        comment(0, depth - 1),
+                    },
+                },
+            },
+        };
+    }
+
+
+    ////|                   |////
+    ////|  Many components  |////
+    ////|                   |////
+
+
+    template<std::size_t N>
+    struct Widget : component<Widget<N>> {
+        Widget () : component<Widget<N>> {
+            {
+                {".widget",
+                    display{"flex"},
+                    padding{"1rem 2rem"},
+                    borderRadius{"4px"},
+                    backgroundColor{"#ffffff"},
+                },
+                {".widget h2",
+                    fontSize{"1.5rem"},
+                    fontWeight{"bold"},
+                    margin{"0px"},
+                },
+                {{".widget a", ".widget a:visited"},
+                    color{"#336699"},
+                    textDecoration{"none"},
+                },
+                atMedia{"(max-width: 600px)",
+                    rule{".widget",
+                        flexDirection{"column"},
+                        padding{"0.5rem"},
+                    },
+                },
+            },
+            dv{{_class{"widget"}},
+                h2{"Widget ", std::to_string(N)},
+                p{"Some descriptive text about this widget."},
+                a{{_href{"/widgets/" + std::to_string(N)}}, "More"},
+            },
+            {
+                link{{_rel{"preload"}, _href{"/widget.png"}, _as{"image"}}},
+            },
+        } {}
+    };
+
+    template<std::size_t... N>
+    inline std::vector<node> widgets (std::index_sequence<N...>) {
+        std::vector<node> nodes;
+        nodes.reserve(sizeof...(N));
+        (nodes.push_back(Widget<N>{}), ...);
+        return nodes;
+    }
+
+    inline doc componentsPage () {
+        return doc{
+            html{
+                head{
+                    title{"Dashboard"},
+                    styleTarget{},
+                    headTarget{},
+                },
+                body{
+                    main{
+                        widgets(std::make_index_sequence<50>{}),
+                    },
+                },
+            },
+        };
+    }
+
+
+    ////|             |////
+    ////|  i18n page  |////
+    ////|             |////
+
+
+    inline const std::vector<std::string>& i18nKeys (std::size_t count) {
+        static std::unordered_map<std::size_t, std::vector<std::string>> cache;
+        auto& keys = cache[count];
+        if (keys.empty()) {
+            for (std::size_t i = 0; i < count; ++i) {
+                keys.push_back("page.section" + std::to_string(i / 10) + ".item" + std::to_string(i));
+            }
+        }
+        return keys;
+    }
+
+    inline const std::unordered_map<std::string_view, std::string>& i18nCatalog (std::size_t count) {
+        static std::unordered_map<std::size_t, std::unordered_map<std::string_view, std::string>> cache;
+        auto& catalog = cache[count];
+        if (catalog.empty()) {
+            for (const auto& key : i18nKeys(count)) {
+                catalog.emplace(key, "Översättning av " + key);
+            }
+        }
+        return catalog;
+    }
+
+    inline PlaceholderPopulator i18nPopulator (std::size_t count = 500) {
+        const auto& catalog = i18nCatalog(count);
+        return [&catalog] (const std::string_view& key, const std::string_view&) -> const std::string_view {
+            auto found = catalog.find(key);
+            return found == catalog.end() ? key : std::string_view{found->second};
+        };
+    }
+
+    inline const PlaceholderValues& i18nValues (std::size_t count = 500) {
+        static std::unordered_map<std::size_t, PlaceholderValues> cache;
+        auto& values = cache[count];
+        if (values.empty()) {
+            values = placeholderValues(i18nCatalog(count));
+        }
+        return values;
+    }
+
+    inline doc i18nPage (std::size_t count = 500) {
+        const auto& keys = i18nKeys(count);
+        return doc{
+            html{
+                head{title{_{"page.title"}}},
+                body{
+                    nav{
+                        ul{
+                            each(std::vector<std::string_view>(keys.begin(), keys.begin() + 10), [] (std::string_view key) {
+                                return li{a{{_href{"#"}, _title{_{key}}}, _{key}}};
+                            }),
+                        },
+                    },
+                    main{
+                        each(std::vector<std::string_view>(keys.begin() + 10, keys.end()), [] (std::string_view key) {
+                            return p{{_class{"copy"}}, _{key}};
+                        }),
+                    },
+                },
+            },
+        };
+    }
+
+    // As i18nPage, but with the body cached once rendered in a locale:
+    inline doc i18nCachedPage (fragmentCache& cache, std::size_t count = 500) {
+        return doc{
+            html{
+                head{title{_{"page.title"}}},
+                body{
+                    cached{cache, [count] () {
+                        const auto& keys = i18nKeys(count);
+                        return fragment{
+                            nav{
+                                ul{
+                                    each(std::vector<std::string_view>(keys.begin(), keys.begin() + 10), [] (std::string_view key) {
+                                        return li{a{{_href{"#"}, _title{_{key}}}, _{key}}};
+                                    }),
+                                },
+                            },
+                            main{
+                                each(std::vector<std::string_view>(keys.begin() + 10, keys.end()), [] (std::string_view key) {
+                                    return p{{_class{"copy"}}, _{key}};
+                                }),
+                            },
+                        };
+                    }},
+                },
+            },
+        };
+    }
+
+    // As i18nPage, but with the keys registered up front:
+    inline const std::vector<PlaceholderKey>& i18nPlaceholderKeys (std::size_t count = 500) {
+        static std::unordered_map<std::size_t, std::vector<PlaceholderKey>> cache;
+        auto& keys = cache[count];
+        if (keys.empty()) {
+            for (const auto& key : i18nKeys(count)) {
+                keys.push_back(placeholderKey(key));
+            }
+        }
+        return keys;
+    }
+
+    inline doc i18nKeyedPage (std::size_t count = 500) {
+        const auto& keys = i18nPlaceholderKeys(count);
+        static const PlaceholderKey pageTitle = placeholderKey("page.title");
+        return doc{
+            html{
+                head{title{pageTitle}},
+                body{
+                    nav{
+                        ul{
+                            each(std::vector<PlaceholderKey>(keys.begin(), keys.begin() + 10), [] (const PlaceholderKey& key) {
+                                return li{a{{_href{"#"}, _title{key}}, key}};
+                            }),
+                        },
+                    },
+                    main{
+                        each(std::vector<PlaceholderKey>(keys.begin() + 10, keys.end()), [] (const PlaceholderKey& key) {
+                            return p{{_class{"copy"}}, key};
+                        }),
+                    },
+                },
+            },
+        };
+    }
+
+
+    ////|               |////
+    ////|  Lazy blocks  |////
+    ////|               |////
+
+
+    inline doc lazyPage (std::size_t count = 1000) {
+        return doc{
+            html{
+                head{title{"Lazy"}},
+                body{
+                    loop(std::vector<int>(count), [] (const int&, const Loop& loop) {
+                        const std::size_t index = loop.index;
+                        return section{
+                            h2{"Section ", std::to_string(index)},
+                            lazy{[index] () {
+                                return p{"Deferred content for section ", std::to_string(index)};
+                            }},
+                        };
+                    }),
+                },
+            },
+        };
+    }
+}
+
+#endif // WEBXX_BENCHMARK_CORPUS_H
@@ -0,0 +1,76 @@
+// Built twice: with and without WEBXX_INSTRUMENT, to show that the
+// instrumentation hooks cost nothing when they are compiled out.
+#include "benchmark/benchmark.h"
+#include "webxx.h"
+
+#include <array>
+
+using namespace Webxx;
+
+#ifdef WEBXX_INSTRUMENT
+constexpr static const char* build{"instrumented"};
+#else
+constexpr static const char* build{"plain"};
+#endif
+constexpr size_t nMany{1000};
+constexpr std::array<size_t,nMany> nItems{};
+
+struct Row : component<Row> {
+    Row (std::size_t index) : component<Row> {
+        {
+            {"li", color{"green"}},
+        },
+        li{{_class{"row"}},
+            std::to_string(index),
+            lazy{[] () { return p{"Something else."}; }},
+        },
+    } {}
+};
+
+html document () {
+    return html{
+        head{
+            styleTarget{},
+        },
+        body{
+            ol{
+                loop(nItems, [] (const auto&, const Loop& loop) {
+                    return Row{loop.index};
+                }),
+            },
+        },
+    };
+}
+
+static void componentLoop1k (benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(render(document()));
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(build);
+}
+BENCHMARK(componentLoop1k);
+
+#ifdef WEBXX_INSTRUMENT
+static void componentLoop1kObserved (benchmark::State& state) {
+    renderStats stats;
+    for (auto _ : state) {
+        internal::RenderOptions options;
+        options.stats = &stats;
+        benchmark::DoNotOptimize(render(document(), std::move(options)));
+        benchmark::ClobberMemory();
+    }
+    state.counters["nodes"] = benchmark::Counter(
+        static_cast<double>(stats.report.nodes),
+        benchmark::Counter::kAvgIterations
+    );
+    state.counters["sinkCalls"] = benchmark::Counter(
+        static_cast<double>(stats.report.sinkCalls),
+        benchmark::Counter::kAvgIterations
+    );
+    state.SetLabel("observed");
+}
+BENCHMARK(componentLoop1kObserved);
+#endif
+
+BENCHMARK_MAIN();
@@ -0,0 +1,84 @@
+// Measures when streamed output actually leaves the renderer: the time to
+// the first flushed chunk, and the latency between subsequent chunks.
+#include "benchmark/benchmark.h"
+#include "corpus.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+static double micros (Clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+static double percentile (std::vector<double>& values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    const std::size_t index = std::min(values.size() - 1, static_cast<std::size_t>(p * static_cast<double>(values.size())));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(index), values.end());
+    return values[index];
+}
+
+template<typename F>
+static void renderStreamed (benchmark::State& state, F&& build) {
+    const std::size_t chunkSize = static_cast<std::size_t>(state.range(0));
+    std::vector<Clock::time_point> flushes;
+    std::vector<double> ttfbs;
+    std::vector<double> gaps;
+    std::size_t chunks{0};
+
+    for (auto _ : state) {
+        auto document = build();
+        flushes.clear();
+
+        const Clock::time_point start = Clock::now();
+        std::string leftovers = Webxx::render(document, {
+            nullptr,
+            [&flushes, chunkSize] (const std::string_view& data, std::string& buffer) {
+                buffer.append(data);
+                if (buffer.size() >= chunkSize) {
+                    benchmark::DoNotOptimize(buffer.data());
+                    buffer.clear();
+                    flushes.push_back(Clock::now());
+                }
+            },
+            chunkSize,
+        });
+        if (!leftovers.empty()) {
+            flushes.push_back(Clock::now());
+        }
+        state.SetIterationTime(std::chrono::duration<double>(flushes.back() - start).count());
+
+        ttfbs.push_back(micros(flushes.front() - start));
+        for (std::size_t i = 1; i < flushes.size(); ++i) {
+            gaps.push_back(micros(flushes[i] - flushes[i - 1]));
+        }
+        chunks = flushes.size();
+    }
+
+    state.counters["chunks"] = static_cast<double>(chunks);
+    state.counters["ttfb_us"] = percentile(ttfbs, 0.5);
+    state.counters["gap_p50_us"] = percentile(gaps, 0.5);
+    state.counters["gap_p90_us"] = percentile(gaps, 0.9);
+    state.counters["gap_p99_us"] = percentile(gaps, 0.99);
+}
+
+static void streamDataTable10k (benchmark::State& state) {
+    renderStreamed(state, [] () { return Corpus::dataTable(10000); });
+}
+BENCHMARK(streamDataTable10k)->RangeMultiplier(8)->Range(256, 64 * 1024)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+static void streamLazy1k (benchmark::State& state) {
+    renderStreamed(state, [] () { return Corpus::lazyPage(1000); });
+}
+BENCHMARK(streamLazy1k)->RangeMultiplier(8)->Range(256, 64 * 1024)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+static void streamComponents50 (benchmark::State& state) {
+    renderStreamed(state, [] () { return Corpus::componentsPage(); });
+}
+BENCHMARK(streamComponents50)->RangeMultiplier(8)->Range(256, 64 * 1024)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
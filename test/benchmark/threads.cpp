@@ -0,0 +1,56 @@
+// Renders corpus documents on many threads at once, to show how throughput
+// scales (or doesn't) with allocator contention and any shared state.
+#include "benchmark/benchmark.h"
+#include "corpus.h"
+
+#include <algorithm>
+#include <thread>
+
+static const int maxThreads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+// Populate the corpus' shared data up-front, so that threads only read it:
+static const bool corpusReady = (
+    Corpus::tableRows(1000),
+    Corpus::i18nCatalog(500),
+    true
+);
+
+template<typename F>
+static void renderConcurrently (benchmark::State& state, F&& build, Webxx::PlaceholderPopulator populator = nullptr) {
+    std::size_t bytes{0};
+    for (auto _ : state) {
+        std::string output = Webxx::render(build(), {populator});
+        bytes = output.size();
+        benchmark::DoNotOptimize(output);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+    state.counters["docs"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+
+static void threadsDataTable1k (benchmark::State& state) {
+    renderConcurrently(state, [] () { return Corpus::dataTable(1000); });
+}
+BENCHMARK(threadsDataTable1k)->ThreadRange(1, maxThreads)->UseRealTime();
+
+static void threadsCommentThread200 (benchmark::State& state) {
+    renderConcurrently(state, [] () { return Corpus::commentThread(200); });
+}
+BENCHMARK(threadsCommentThread200)->ThreadRange(1, maxThreads)->UseRealTime();
+
+static void threadsComponents50 (benchmark::State& state) {
+    renderConcurrently(state, [] () { return Corpus::componentsPage(); });
+}
+BENCHMARK(threadsComponents50)->ThreadRange(1, maxThreads)->UseRealTime();
+
+static void threadsI18n500 (benchmark::State& state) {
+    renderConcurrently(state, [] () { return Corpus::i18nPage(500); }, Corpus::i18nPopulator(500));
+}
+BENCHMARK(threadsI18n500)->ThreadRange(1, maxThreads)->UseRealTime();
+
+static void threadsLazy1k (benchmark::State& state) {
+    renderConcurrently(state, [] () { return Corpus::lazyPage(1000); });
+}
+BENCHMARK(threadsLazy1k)->ThreadRange(1, maxThreads)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,147 @@
+// Compares walking a document recursively against walking it with an explicit
+// stack (as the renderer & collector do), on deep and on wide trees. The two
+// reference walkers only render tags, attributes & text, so they bound the
+// cost of the traversal itself; webxx's own render is included alongside.
+#include "benchmark/benchmark.h"
+#include "webxx.h"
+
+#include <vector>
+
+using namespace Webxx;
+using internal::HtmlNode;
+
+
+////|         |////
+////|  Trees  |////
+////|         |////
+
+
+static HtmlNode deepTree (std::size_t depth) {
+    HtmlNode tree = span{"leaf"};
+    for (std::size_t i = 0; i < depth; ++i) {
+        tree = dv{{_class{"level"}}, std::move(tree)};
+    }
+    return tree;
+}
+
+static HtmlNode wideTree (std::size_t width) {
+    std::vector<HtmlNode> children;
+    children.reserve(width);
+    for (std::size_t i = 0; i < width; ++i) {
+        children.push_back(li{{_class{"item"}}, "leaf"});
+    }
+    return ul{std::move(children)};
+}
+
+
+////|           |////
+////|  Walkers  |////
+////|           |////
+
+
+static void renderOpen (const HtmlNode& node, std::string& out) {
+    const std::string_view tag = node.data.options.tagName();
+    if (!tag.empty()) {
+        out.append("<").append(tag);
+        for (const auto& attribute : node.data.attributes) {
+            out.append(" ").append(attribute.data.name());
+            for (const auto& value : attribute.data.values) {
+                out.append("=\"").append(value.view).append("\"");
+            }
+        }
+        out.append(">");
+    }
+    out.append(node.data.content.view);
+}
+
+static void renderClose (const HtmlNode& node, std::string& out) {
+    const std::string_view tag = node.data.options.tagName();
+    if (!tag.empty()) {
+        out.append("</").append(tag).append(">");
+    }
+}
+
+static void walkRecursive (const HtmlNode& node, std::string& out) {
+    renderOpen(node, out);
+    for (const auto& child : node.data.children) {
+        walkRecursive(child, out);
+    }
+    renderClose(node, out);
+}
+
+static void walkIterative (const HtmlNode& root, std::string& out) {
+    struct Frame {
+        const HtmlNode* node;
+        std::size_t child;
+    };
+    std::vector<Frame> frames;
+    renderOpen(root, out);
+    frames.push_back({&root, 0});
+    while (!frames.empty()) {
+        Frame& frame = frames.back();
+        if (frame.child == frame.node->data.children.size()) {
+            renderClose(*frame.node, out);
+            frames.pop_back();
+        } else {
+            const HtmlNode* child = &frame.node->data.children[frame.child++];
+            renderOpen(*child, out);
+            frames.push_back({child, 0});
+        }
+    }
+}
+
+
+////|              |////
+////|  Benchmarks  |////
+////|              |////
+
+
+template<typename B, typename W>
+static void traverse (benchmark::State& state, B&& build, W&& walk) {
+    const HtmlNode tree = build(static_cast<std::size_t>(state.range(0)));
+    std::size_t bytes{0};
+    for (auto _ : state) {
+        std::string output;
+        walk(tree, output);
+        bytes = output.size();
+        benchmark::DoNotOptimize(output);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+static void renderWebxx (const HtmlNode& tree, std::string& out) {
+    out = render(tree);
+}
+
+static void traversalDeepRecursive (benchmark::State& state) {
+    traverse(state, deepTree, walkRecursive);
+}
+BENCHMARK(traversalDeepRecursive)->Arg(1000);
+
+static void traversalDeepIterative (benchmark::State& state) {
+    traverse(state, deepTree, walkIterative);
+}
+BENCHMARK(traversalDeepIterative)->Arg(1000);
+
+static void traversalDeepWebxx (benchmark::State& state) {
+    traverse(state, deepTree, renderWebxx);
+}
+BENCHMARK(traversalDeepWebxx)->Arg(1000);
+
+static void traversalWideRecursive (benchmark::State& state) {
+    traverse(state, wideTree, walkRecursive);
+}
+BENCHMARK(traversalWideRecursive)->Arg(10000);
+
+static void traversalWideIterative (benchmark::State& state) {
+    traverse(state, wideTree, walkIterative);
+}
+BENCHMARK(traversalWideIterative)->Arg(10000);
+
+static void traversalWideWebxx (benchmark::State& state) {
+    traverse(state, wideTree, renderWebxx);
+}
+BENCHMARK(traversalWideWebxx)->Arg(10000);
+
+BENCHMARK_MAIN();
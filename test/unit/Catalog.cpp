@@ -0,0 +1,55 @@
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+#include <string>
+
+namespace {
+    inline constexpr std::string_view navKeys[] = {"nav.home", "nav.about", "nav.contact"};
+}
+
+TEST_SUITE("Catalog") {
+    using namespace Webxx;
+    using Nav = catalog<navKeys>;
+
+    TEST_CASE("Catalog keys are found at compile time") {
+        static_assert(Nav::size == 3);
+        static_assert(Nav::index("nav.home") == 0);
+        static_assert(Nav::index("nav.contact") == 2);
+
+        const std::string missing{"nav.missing"};
+        CHECK_THROWS_AS(Nav::index(missing), std::out_of_range);
+    }
+
+    TEST_CASE("Catalog keys can be populated from a locale") {
+        const std::string swedish{
+            "# Swedish\n"
+            "nav.home=Hem\r\n"
+            "nav.about=Om oss\n"
+            "nav.unknown=Okänd\n"
+            "\n"
+            "nav.contact=Kontakt"
+        };
+        const PlaceholderValues values = Nav::values(swedish);
+
+        auto navigation = [] () {
+            return ul{
+                li{Nav::key<Nav::index("nav.home")>()},
+                li{{_title{Nav::key<Nav::index("nav.about")>()}}, Nav::key<Nav::index("nav.about")>()},
+                li{_{"nav.contact"}},
+            };
+        };
+
+        internal::RenderOptions options;
+        options.placeholderValues = &values;
+        CHECK(render(navigation(), std::move(options)) ==
+            "<ul><li>Hem</li><li title=\"Om oss\">Om oss</li><li>Kontakt</li></ul>");
+
+        SUBCASE("Catalog keys missing from a locale are left to the populator") {
+            const PlaceholderValues partial = Nav::values("nav.about=Om oss\n");
+            internal::RenderOptions partialOptions;
+            partialOptions.placeholderValues = &partial;
+            CHECK(render(navigation(), std::move(partialOptions)) ==
+                "<ul><li>nav.home</li><li title=\"Om oss\">Om oss</li><li>nav.contact</li></ul>");
+        }
+    }
+}
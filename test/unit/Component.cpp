@@ -2,6 +2,11 @@
 #include "fmt/core.h"
 #include "webxx.h"
 
+namespace {
+    inline constexpr char templates[] = "templates";
+    inline constexpr char preloads[] = "preloads";
+}
+
 TEST_SUITE("Component") {
     using namespace Webxx;
 
@@ -27,7 +32,7 @@ TEST_SUITE("Component") {
         };
 
         MyCom myCom{};
-        auto myComId = myCom.data.componentTypeId;
+        auto myComId = myCom.data.componentTypeId();
 
         // CHECK(myCom->css.size() == 2);
 
@@ -106,6 +111,279 @@ TEST_SUITE("Component") {
         }
     }
 
+    TEST_CASE("Head elements are only rendered once, however many times they appear") {
+        struct Map : component<Map> {
+            Map() : component<Map> {
+                {},
+                dv{"Map"},
+                {
+                    Webxx::link{{_rel{"preconnect"}, _href{"https://tiles.example"}}},
+                    meta{{_name{"map"}}},
+                },
+            } {}
+        };
+
+        struct Chart : component<Chart> {
+            Chart() : component<Chart> {
+                {},
+                dv{"Chart"},
+                {
+                    Webxx::link{{_rel{"preconnect"}, _href{"https://tiles.example"}}},
+                    meta{{_name{"chart"}}},
+                },
+            } {}
+        };
+
+        const auto mapId = Map{}.data.componentTypeId();
+        const auto chartId = Chart{}.data.componentTypeId();
+        html myPage {
+            head {
+                headTarget{},
+            },
+            body {
+                Map{},
+                Chart{},
+                Map{},
+                // Outside of any component:
+                fragment{headElements{title{"Maps"}}},
+                fragment{headElements{title{"Maps"}, meta{{_name{"page"}}}}},
+            },
+        };
+
+        CHECK(render(myPage) == fmt::format(
+            "<html>"
+                "<head>"
+                    // In the order first collected, with the scope of the first to collect it:
+                    "<link rel=\"preconnect\" href=\"https://tiles.example\" data-c{0}/>"
+                    "<meta name=\"map\" data-c{0}/>"
+                    "<meta name=\"chart\" data-c{1}/>"
+                    "<title>Maps</title>"
+                    "<meta name=\"page\"/>"
+                "</head>"
+                "<body>"
+                    "<div data-c{0}>Map</div>"
+                    "<div data-c{1}>Chart</div>"
+                    "<div data-c{0}>Map</div>"
+                "</body>"
+            "</html>",
+            mapId,
+            chartId
+        ));
+    }
+
+    TEST_CASE("Head elements are only left out when known to render the same") {
+        html myPage {
+            head {
+                headTarget{},
+            },
+            body {
+                headElements{
+                    title{_{"x"}},
+                    title{"x"},
+                    lazy{[] () { return meta{{_name{"a"}}}; }},
+                    lazy{[] () { return meta{{_name{"b"}}}; }},
+                },
+            },
+        };
+
+        internal::RenderOptions options{[] (const std::string_view&, const std::string_view&) {
+            return std::string_view{"y"};
+        }};
+        CHECK(render(myPage, std::move(options)) ==
+            "<html>"
+                "<head>"
+                    "<title>y</title>"
+                    "<title>x</title>"
+                    "<meta name=\"a\"/>"
+                    "<meta name=\"b\"/>"
+                "</head>"
+                "<body></body>"
+            "</html>"
+        );
+    }
+
+    TEST_CASE("Head elements are compared, rather than only their digests") {
+        CHECK(internal::sameNodes(meta{{_name{"a"}, _content{"b"}}}, meta{{_name{"a"}, _content{"b"}}}));
+        CHECK(!internal::sameNodes(meta{{_name{"a"}, _content{"b"}}}, meta{{_name{"a"}, _content{"c"}}}));
+        CHECK(!internal::sameNodes(meta{{_name{"a"}}}, meta{{_name{"a"}, _content{""}}}));
+        CHECK(!internal::sameNodes(title{_{"x"}}, title{"x"}));
+        CHECK(!internal::sameNodes(dv{p{}, p{}}, dv{p{}}));
+
+        const internal::HtmlNode lazyMeta = lazy{[] () { return meta{}; }};
+        CHECK(internal::sameNodes(lazyMeta, lazyMeta));
+        CHECK(!internal::sameNodes(lazyMeta, lazy{[] () { return meta{}; }}));
+    }
+
+    TEST_CASE("Component scripts are collected and rendered") {
+        struct Widget : component<Widget> {
+            Widget(std::string label) : component<Widget> {
+                {},
+                button{{_class{"widget"}}, std::move(label)},
+                {},
+                {
+                    "document.querySelectorAll('.widget').forEach(init);",
+                },
+            } {}
+        };
+
+        const auto widgetId = Widget{"A"}.data.componentTypeId();
+        html myPage {
+            body {
+                Widget{"A"},
+                Widget{"B"},
+                scriptTarget{},
+            },
+        };
+
+        CHECK(render(myPage) == fmt::format(
+            "<html>"
+                "<body>"
+                    "<button class=\"widget\" data-c{0}>A</button>"
+                    "<button class=\"widget\" data-c{0}>B</button>"
+                    // Collected script only appears once:
+                    "<script data-c{0}>document.querySelectorAll('.widget').forEach(init);</script>"
+                "</body>"
+            "</html>",
+            widgetId
+        ));
+    }
+
+    TEST_CASE("Named collections are collected and rendered") {
+        struct Row : component<Row> {
+            Row(std::string name) : component<Row> {
+                tr{
+                    td{std::move(name)},
+                    collection<templates>{
+                        template_{{_id{"row"}}, tr{td{}}},
+                    },
+                    collection<preloads>{
+                        Webxx::link{{_rel{"preload"}, _href{"/row.css"}}},
+                    },
+                },
+            } {}
+        };
+
+        const auto rowId = Row{"a"}.data.componentTypeId();
+        dv myPage {
+            collectionTarget<preloads>{},
+            table{Row{"a"}, Row{"b"}},
+            collectionTarget<templates>{},
+            collectionTarget<templates>{},
+        };
+
+        const std::string templateHtml{fmt::format("<template id=\"row\" data-c{0}><tr data-c{0}><td data-c{0}></td></tr></template>", rowId)};
+        CHECK(render(myPage) == fmt::format(
+            "<div>"
+                "<link rel=\"preload\" href=\"/row.css\" data-c{0}/>"
+                "<table><tr data-c{0}><td data-c{0}>a</td></tr><tr data-c{0}><td data-c{0}>b</td></tr></table>"
+                // Each target of a collection renders it once:
+                "{1}{1}"
+            "</div>",
+            rowId,
+            templateHtml
+        ));
+    }
+
+    TEST_CASE("Collections outside of components are kept once per content, in order") {
+        dv myPage {
+            collection<templates>{template_{{_id{"b"}}}},
+            collection<templates>{template_{{_id{"a"}}}},
+            collection<templates>{template_{{_id{"b"}}}},
+            collectionTarget<templates>{},
+        };
+
+        CHECK(render(myPage) == "<div><template id=\"b\"></template><template id=\"a\"></template></div>");
+    }
+
+    TEST_CASE("Component variables are collected into one :root rule") {
+        struct Button : component<Button> {
+            Button() : component<Button> {
+                {
+                    {"button", color{"var(--accent)"}},
+                },
+                fragment{
+                    variables{prop{"--accent", "blue"}, prop{"--radius", "4px"}},
+                    button{"Go"},
+                },
+            } {}
+        };
+
+        struct Card : component<Card> {
+            Card() : component<Card> {
+                fragment{
+                    variables{prop{"--radius", "8px"}, prop{"--shadow", "none"}},
+                    dv{Button{}},
+                },
+            } {}
+        };
+
+        html myPage {
+            head {
+                variableTarget{},
+            },
+            body {
+                Card{},
+                Card{},
+                // Declared outside of any component, so overrides the components:
+                variables{prop{"--accent", "red"}},
+            },
+        };
+
+        const std::string html = render(myPage);
+        const std::string root = html.substr(0, html.find("</style>"));
+
+        // Each variable is only declared once, with the outer card's radius:
+        CHECK(root == "<html><head><style>:root{--radius:8px;--shadow:none;--accent:red;}");
+        CHECK(html.find("--accent", root.size()) == std::string::npos);
+
+        SUBCASE("Nothing is rendered without variables") {
+            CHECK(render(dv{variableTarget{}}) == "<div><style></style></div>");
+        }
+    }
+
+    TEST_CASE("Component styles can be optimized") {
+        struct Shortened : component<Shortened> {
+            Shortened() : component<Shortened> {
+                {
+                    {".title", color{"#FFFFFF"}, margin{"0px auto"}},
+                    {".title", color{"#ff0000"}},
+                    {".summary", margin{"0 auto"}, color{"#ff0000"}},
+                    {".fallback", display{"-webkit-box"}, display{"flex"}, width{"calc(100% - 0px)"}},
+                    {".important", color{"red !important"}, color{"blue"}},
+                    {".flex", flex{"1 1 0px"}, flexBasis{"0px"}, prop{"--gap", "0px"}, prop{"--ink", "#ffffff"}},
+                    atMedia{"(min-width: 900px)", {
+                        {".title", padding{"0em"}, padding{"1em"}},
+                    }},
+                },
+                dv{"Hello"},
+            } {}
+        };
+
+        const auto id = Shortened{}.data.componentTypeId();
+        auto optimized = [] () {
+            internal::RenderOptions options;
+            options.optimizeCss = true;
+            return renderCss(Shortened{}, std::move(options));
+        };
+
+        CHECK(optimized() == fmt::format(
+            ".title[data-c{0}],.summary[data-c{0}]{{margin:0 auto;color:#f00}}"
+            ".fallback[data-c{0}]{{display:-webkit-box;display:flex;width:calc(100% - 0px)}}"
+            ".important[data-c{0}]{{color:red !important;color:blue}}"
+            ".flex[data-c{0}]{{flex:1 1 0px;flex-basis:0px;--gap:0px;--ink:#ffffff}}"
+            "@media (min-width: 900px){{.title[data-c{0}]{{padding:1em}}}}",
+            id
+        ));
+
+        SUBCASE("Optimized styles are reused") {
+            CHECK(optimized() == optimized());
+        }
+
+        SUBCASE("Styles are not optimized by default") {
+            CHECK(renderCss(Shortened{}).find(".title[data-c" + std::to_string(id) + "]{color:#FFFFFF;margin:0px auto;}") == 0);
+        }
+    }
+
     TEST_CASE("Components can be nested") {
         struct ComA : component<ComA> {
             ComA(std::string msg) : component<ComA> {
@@ -131,7 +409,9 @@ TEST_SUITE("Component") {
         };
 
         ComA comA{ComA{"Hello A"}};
+        const auto comAId = comA.data.componentTypeId();
         ComB comB{std::move(comA)};
+        const auto comBId = comB.data.componentTypeId();
 
         doc doc {
             html {
@@ -153,8 +433,8 @@ TEST_SUITE("Component") {
                     "<style>"
         };
         // Collected styles from all components, with each only appearing once:
-        std::string cssComA{fmt::format(".a[data-c{0}]{{color:green;}}", comA.data.componentTypeId)};
-        std::string cssComB{fmt::format(".b[data-c{0}]{{color:blue;}}", comB.data.componentTypeId)};
+        std::string cssComA{fmt::format(".a[data-c{0}]{{color:green;}}", comAId)};
+        std::string cssComB{fmt::format(".b[data-c{0}]{{color:blue;}}", comBId)};
         std::string htmlEnd{fmt::format(
                 "</style>"
                 "</head>"
@@ -167,8 +447,8 @@ TEST_SUITE("Component") {
                     "</div>"
                 "</body>"
             "</html>",
-            comA.data.componentTypeId,
-            comB.data.componentTypeId
+            comAId,
+            comBId
         )};
 
         CHECK(html.find(htmlStart) == 0);
@@ -0,0 +1,111 @@
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+#ifdef WEBXX_ZLIB
+#include "webxx/compression.h"
+
+#include <cstdint>
+
+TEST_SUITE("Compression") {
+    using namespace Webxx;
+
+    std::string inflateAll (const std::string& compressed, int windowBits) {
+        z_stream stream{};
+        inflateInit2(&stream, windowBits);
+
+        std::string out;
+        char buffer[1024];
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+        stream.avail_in = static_cast<uInt>(compressed.size());
+        int status = Z_OK;
+        while (status == Z_OK) {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+            status = inflate(&stream, Z_NO_FLUSH);
+            out.append(buffer, sizeof(buffer) - stream.avail_out);
+        }
+        inflateEnd(&stream);
+
+        return status == Z_STREAM_END ? out : "<corrupt>";
+    }
+
+    ol list () {
+        return ol{
+            loop(std::vector<int>(200), [] (const int&, const Loop& loop) {
+                return li{{_class{"item"}}, std::to_string(loop.index)};
+            }),
+        };
+    }
+
+    TEST_CASE("Render can be compressed as it streams") {
+        const std::string expected = render(list());
+
+        SUBCASE("Gzip output can be inflated") {
+            compressor gzip;
+            render(list(), {nullptr, gzip.receiver()});
+            gzip.finish();
+
+            CHECK(gzip.output().size() < expected.size());
+            CHECK(inflateAll(gzip.output(), 15 + 16) == expected);
+        }
+
+        SUBCASE("Zlib output can be inflated") {
+            compressor deflate{{}, {compressionFormat::ZLIB, 9, 0}};
+            render(list(), {nullptr, deflate.receiver()});
+            deflate.finish();
+
+            CHECK(inflateAll(deflate.output(), 15) == expected);
+        }
+
+        SUBCASE("Output is flushed to the receiver at boundaries") {
+            std::string out;
+            std::size_t chunks{0};
+            compressor gzip{[&] (const std::string_view& chunk) {
+                out.append(chunk);
+                ++chunks;
+            }, {compressionFormat::GZIP, 6, 512}};
+
+            render(list(), {nullptr, gzip.receiver()});
+            CHECK(chunks > 1);
+
+            gzip.finish();
+            CHECK(inflateAll(out, 15 + 16) == expected);
+        }
+    }
+
+    TEST_CASE("Pre-compressed segments can be spliced into a stream") {
+        const std::string header = render(dv{{_class{"header"}}, h1{"Static header"}});
+        const std::string footer = render(dv{{_class{"footer"}}, p{"Static footer"}});
+        const compressedSegment headerSegment = compressSegment(header);
+        const compressedSegment footerSegment = compressSegment(footer);
+
+        for (auto format : {compressionFormat::GZIP, compressionFormat::ZLIB}) {
+            compressor stream{{}, {format, 6, 0}};
+            stream.write(headerSegment);
+            render(list(), {nullptr, stream.receiver()});
+            stream.write(footerSegment);
+            stream.finish();
+
+            CHECK(inflateAll(stream.output(), format == compressionFormat::GZIP ? 15 + 16 : 15) ==
+                header + render(list()) + footer);
+        }
+    }
+
+    TEST_CASE("Segments larger than a chunk of output are spliced whole") {
+        // Incompressible, so that the deflated segment is larger than its input:
+        std::string noise(256 * 1024, '\0');
+        std::uint32_t state{1};
+        for (auto &c : noise) {
+            state = state * 1664525u + 1013904223u;
+            c = static_cast<char>(state >> 24);
+        }
+        const compressedSegment segment = compressSegment(noise);
+        CHECK(segment.bytes.size() > noise.size());
+
+        compressor stream{{}, {compressionFormat::GZIP, 6, 0}};
+        stream.write(segment);
+        stream.finish();
+        CHECK(inflateAll(stream.output(), 15 + 16) == noise);
+    }
+}
+#endif
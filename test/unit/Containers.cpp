@@ -0,0 +1,69 @@
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+TEST_SUITE("Containers") {
+    using namespace Webxx;
+    using Strings = internal::SmallVector<std::string, 2>;
+
+    bool isInline (const Strings& strings) {
+        const void* data = strings.begin();
+        return data >= static_cast<const void*>(&strings) && data < static_cast<const void*>(&strings + 1);
+    }
+
+    TEST_CASE("Small vector stores elements inline until full") {
+        Strings strings{"a", "b"};
+
+        CHECK(strings.size() == 2);
+        CHECK(isInline(strings));
+
+        SUBCASE("Small vector moves to the heap when it grows") {
+            strings.push_back("c");
+            strings.emplace_back(3, 'd');
+
+            CHECK(strings.size() == 4);
+            CHECK(!isInline(strings));
+            CHECK(strings[0] == "a");
+            CHECK(strings[3] == "ddd");
+        }
+    }
+
+    TEST_CASE("Small vector can be moved") {
+        Strings inlined{"a"};
+        Strings heaped{"a", "b", "c"};
+
+        Strings movedInlined{std::move(inlined)};
+        Strings movedHeaped{std::move(heaped)};
+
+        CHECK(inlined.empty());
+        CHECK(heaped.empty());
+        CHECK(movedInlined.size() == 1);
+        CHECK(movedInlined[0] == "a");
+        CHECK(movedHeaped.size() == 3);
+        CHECK(movedHeaped[2] == "c");
+
+        movedInlined = std::move(movedHeaped);
+        CHECK(movedInlined.size() == 3);
+        CHECK(movedHeaped.empty());
+    }
+
+    TEST_CASE("Small vector can be used as a stack") {
+        Strings stack{"a", "b"};
+        stack.push_back("c");
+
+        CHECK(stack.back() == "c");
+        stack.pop_back();
+        CHECK(stack.back() == "b");
+        stack.pop_back();
+        stack.pop_back();
+        CHECK(stack.empty());
+    }
+
+    TEST_CASE("Attribute values and selectors are stored inline") {
+        _class attribute{"a"};
+        internal::CssRule rule{".a", color{"red"}};
+
+        CHECK(attribute.data.values.size() == 1);
+        CHECK(rule.data.selectors.size() == 1);
+        CHECK(render(dv{{_class{"a", "b"}}, "x"}) == "<div class=\"a b\">x</div>");
+    }
+}
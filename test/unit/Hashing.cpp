@@ -0,0 +1,68 @@
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+TEST_SUITE("Hashing") {
+    using namespace Webxx;
+
+    ol list () {
+        return ol{
+            loop(std::vector<int>(100), [] (const int&, const Loop& loop) {
+                return li{std::to_string(loop.index)};
+            }),
+        };
+    }
+
+    TEST_CASE("Content hash matches reference XXH64 values") {
+        CHECK(contentHash{}.digest() == 0xef46db3751d8e999ULL);
+
+        contentHash abc;
+        abc.update("abc");
+        CHECK(abc.digest() == 0x44bc2cf5ad770999ULL);
+        CHECK(abc.etag() == "\"44bc2cf5ad770999\"");
+    }
+
+    TEST_CASE("Content hash does not depend on how input is split") {
+        const std::string input{"The quick brown fox jumps over the lazy dog, repeatedly and at length."};
+
+        contentHash whole;
+        whole.update(input);
+
+        for (std::size_t step : {1, 3, 7, 31, 32, 33}) {
+            contentHash pieces;
+            for (std::size_t i = 0; i < input.size(); i += step) {
+                pieces.update(std::string_view{input}.substr(i, step));
+            }
+            CHECK(pieces.digest() == whole.digest());
+        }
+    }
+
+    TEST_CASE("Render output can be hashed as it is produced") {
+        const std::string expected = render(list());
+        contentHash reference;
+        reference.update(expected);
+        CHECK(reference.digest() == 0x329f3b65ef36ead2ULL);
+
+        SUBCASE("Hashed render returns output and digest") {
+            auto hashed = renderHashed(list());
+            CHECK(hashed.output == expected);
+            CHECK(hashed.hash.digest() == reference.digest());
+        }
+
+        SUBCASE("Hash-only render does not buffer output") {
+            CHECK(renderHash(list()).digest() == reference.digest());
+        }
+
+        SUBCASE("Hash can be gathered alongside a custom receiver") {
+            std::string streamed;
+            contentHash hash;
+            internal::RenderOptions options{nullptr, [&streamed] (const std::string_view& data, std::string&) {
+                streamed.append(data);
+            }};
+            options.contentHash = &hash;
+            render(list(), std::move(options));
+
+            CHECK(streamed == expected);
+            CHECK(hash.digest() == reference.digest());
+        }
+    }
+}
@@ -1,6 +1,16 @@
 #include "doctest/doctest.h"
 #include "webxx.h"
+#include <cstdint>
 #include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Webxx {
+    WEBXX_HTML_EL(widget);
+    WEBXX_HTML_EL_SELF_CLOSING(sprite);
+    WEBXX_HTML_ATTR(tone);
+}
 
 TEST_SUITE("Attribute") {
     using namespace Webxx;
@@ -11,7 +21,7 @@ TEST_SUITE("Attribute") {
     TEST_CASE("Attribute can be created empty") {
         _class attribute{};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values.empty());
 
         SUBCASE("Empty attribute can be rendered") {
@@ -23,7 +33,7 @@ TEST_SUITE("Attribute") {
     TEST_CASE("Attribute can be created with string literal") {
         _class attribute{"big"};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values[0].view == "big");
 
         SUBCASE("String literal attribute can be rendered") {
@@ -36,7 +46,7 @@ TEST_SUITE("Attribute") {
         const char value[] = "big";
         _class attribute{value};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values[0].view == value);
 
         SUBCASE("Const char attribute can be rendered") {
@@ -49,7 +59,7 @@ TEST_SUITE("Attribute") {
         std::string value{"big"};
         _class attribute{value};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values[0].view == value);
 
         SUBCASE("std::string attribute can be rendered") {
@@ -62,7 +72,7 @@ TEST_SUITE("Attribute") {
         const std::string_view value{"replacable"};
         _class attribute{_{value}};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values[0].view == value);
 
         SUBCASE("Placeholder attribute can be rendered") {
@@ -74,7 +84,7 @@ TEST_SUITE("Attribute") {
     TEST_CASE("Attribute can be created with multiple values") {
         _class attribute{"big", "tall"};
 
-        CHECK(std::string(attribute.data.name) == "class");
+        CHECK(std::string(attribute.data.name()) == "class");
         CHECK(attribute.data.values[0].view == "big");
         CHECK(attribute.data.values[1].view == "tall");
 
@@ -87,7 +97,7 @@ TEST_SUITE("Attribute") {
     TEST_CASE("Custom attribute can be defined") {
         _dataCustom customAttribute{"something"};
 
-        CHECK(std::string(customAttribute.data.name) == "data-custom");
+        CHECK(std::string(customAttribute.data.name()) == "data-custom");
         CHECK(customAttribute.data.values[0].view == "something");
 
         SUBCASE("Custom attribute can be rendered") {
@@ -165,7 +175,7 @@ TEST_SUITE("Node") {
     TEST_CASE("Node can be empty") {
         h1 node;
 
-        CHECK(std::string(node.data.options.tagName) == "h1");
+        CHECK(std::string(node.data.options.tagName()) == "h1");
 
         SUBCASE("Empty node can be rendered") {
             CHECK(render(node) == "<h1></h1>");
@@ -238,6 +248,102 @@ TEST_SUITE("Node") {
         }
     }
 
+    TEST_CASE("Placeholders can be populated from a table of values") {
+        const std::unordered_map<std::string_view, std::string_view> swedish {
+            {"Hello", "Hej"},
+            {"world", "värld"},
+        };
+        const std::unordered_map<std::string_view, std::string_view> danish {
+            {"Hello", "Hej"},
+            {"world", "verden"},
+        };
+        const PlaceholderValues swedishValues = placeholderValues(swedish);
+        const PlaceholderValues danishValues = placeholderValues(danish);
+        auto fallbackPopulator = [] (const std::string_view& key, const std::string_view) -> std::string_view {
+            return key == "missing" ? "!" : "?";
+        };
+
+        auto greeting = [] () {
+            return h1{{_title{_{"world"}}}, _{"Hello"}, " ", _{"world"}, _{"missing"}};
+        };
+
+        auto renderIn = [&] (const PlaceholderValues& values) {
+            internal::RenderOptions options{fallbackPopulator};
+            options.placeholderValues = &values;
+            return render(greeting(), std::move(options));
+        };
+
+        CHECK(renderIn(swedishValues) == "<h1 title=\"värld\">Hej värld!</h1>");
+        CHECK(renderIn(danishValues) == "<h1 title=\"verden\">Hej verden!</h1>");
+
+        SUBCASE("Placeholders without a table are populated by the populator") {
+            CHECK(render(greeting(), {fallbackPopulator}) == "<h1 title=\"?\">? ?!</h1>");
+        }
+    }
+
+    TEST_CASE("Placeholder keys can be registered once") {
+        static const PlaceholderKey farewell = placeholderKey("Goodbye");
+        const std::unordered_map<std::string_view, std::string_view> swedish {
+            {"Goodbye", "Hejdå"},
+        };
+        const PlaceholderValues values = placeholderValues(swedish);
+
+        CHECK(placeholderKey("Goodbye").slot == farewell.slot);
+        CHECK(render(p{farewell}) == "<p>Goodbye</p>");
+
+        internal::RenderOptions options;
+        options.placeholderValues = &values;
+        CHECK(render(p{{_title{farewell}}, farewell}, std::move(options)) == "<p title=\"Hejdå\">Hejdå</p>");
+    }
+
+    TEST_CASE("Placeholder keys are found as the catalog grows") {
+        std::vector<std::string> keys;
+        std::vector<PlaceholderKey> registered;
+        for (std::size_t i = 0; i < 500; ++i) {
+            keys.push_back("grown-" + std::to_string(i));
+            registered.push_back(placeholderKey(keys.back()));
+        }
+
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            CHECK(internal::placeholderCatalog().find(keys[i]) == registered[i].slot);
+            CHECK(placeholderKey(keys[i]).slot == registered[i].slot);
+        }
+        CHECK(internal::placeholderCatalog().find("grown-missing") == internal::noPlaceholderSlot);
+    }
+
+    TEST_CASE("Placeholders can be written straight to the render") {
+        auto cart = [] () {
+            return p{{_title{_{"cart"}}}, _{"cart"}, " ", _{"other"}};
+        };
+
+        auto renderWith = [&cart] (int count) {
+            internal::RenderOptions options;
+            options.placeholderWriter = [count] (const std::string_view& key, const std::string_view&, PlaceholderWriter& out) {
+                if (key == "cart") {
+                    out << count << (count == 1 ? " item" : " items");
+                } else {
+                    out << key;
+                }
+            };
+            return render(cart(), std::move(options));
+        };
+
+        CHECK(renderWith(1) == "<p title=\"1 item\">1 item other</p>");
+        CHECK(renderWith(-20) == "<p title=\"-20 items\">-20 items other</p>");
+    }
+
+    TEST_CASE("Placeholder writers write characters as text & small integers as digits") {
+        internal::RenderOptions options;
+        options.placeholderWriter = [] (const std::string_view&, const std::string_view&, PlaceholderWriter& out) {
+            out << '(' << std::int8_t{-8} << ',' << std::uint8_t{200} << ')';
+        };
+        CHECK(render(p{_{"pair"}}, std::move(options)) == "<p>(-8,200)</p>");
+
+        static_assert(!internal::isWritableNumber<bool>);
+        static_assert(!internal::isWritableNumber<wchar_t>);
+        static_assert(internal::isWritableNumber<unsigned long long>);
+    }
+
     TEST_CASE("Node can have multiple text content") {
         h1 node{"Hello", " world"};
 
@@ -305,8 +411,8 @@ TEST_SUITE("Node") {
     TEST_CASE("Node can be self-closing") {
         img node;
 
-        CHECK(std::string(node.data.options.tagName) == "img");
-        CHECK(node.data.options.selfClosing == true);
+        CHECK(std::string(node.data.options.tagName()) == "img");
+        CHECK(node.data.options.selfClosing() == true);
 
         SUBCASE("Self-closing node can be rendered") {
             CHECK(render(node) == "<img/>");
@@ -324,11 +430,45 @@ TEST_SUITE("Node") {
     TEST_CASE("Node can have prefix") {
         doc node;
 
-        CHECK(std::string(node.data.options.tagName) == "");
-        CHECK(std::string(node.data.options.prefix) == "<!doctype html>");
+        CHECK(std::string(node.data.options.tagName()) == "");
+        CHECK(std::string(node.data.options.prefix()) == "<!doctype html>");
 
         SUBCASE("Prefixed node can be rendered") {
             CHECK(render(node) == "<!doctype html>");
         }
     }
-}
\ No newline at end of file
+
+    TEST_CASE("Void elements are self-closing") {
+        CHECK(render(br{}) == "<br/>");
+        CHECK(render(input{{_type{"checkbox"}, _checked{}}}) == "<input type=\"checkbox\" checked/>");
+    }
+
+    TEST_CASE("Standard names are looked up by ID") {
+        h1 node;
+        _disabled attribute;
+
+        CHECK(node.data.options.tag == internal::HtmlTag::h1);
+        CHECK(attribute.data.id == internal::HtmlAttr::_disabled);
+        CHECK(attribute.data.info().flags & internal::BOOLEAN_ATTRIBUTE);
+        CHECK(script{}.data.options.info().flags & internal::RAW_TEXT);
+        CHECK(sizeof(internal::HtmlNodeOptions) <= 4);
+    }
+
+    static constexpr char customElTag[] = "custom-el";
+    using customEl = el<customElTag>;
+
+    TEST_CASE("Custom names are given IDs after the standard ones") {
+        customEl first;
+        customEl second{"text"};
+
+        CHECK(first.data.options.tag >= internal::HtmlTag::CUSTOM);
+        CHECK(first.data.options.tag == second.data.options.tag);
+        CHECK(std::string(first.data.options.tagName()) == "custom-el");
+        CHECK(render(second) == "<custom-el>text</custom-el>");
+    }
+
+    TEST_CASE("Custom elements & attributes can be defined with macros") {
+        CHECK(widget{}.data.options.tag >= internal::HtmlTag::CUSTOM);
+        CHECK(render(widget{{_tone{"warm"}}, sprite{}}) == "<widget tone=\"warm\"><sprite/></widget>");
+    }
+}
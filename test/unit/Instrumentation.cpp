@@ -0,0 +1,64 @@
+#define WEBXX_INSTRUMENT
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+TEST_SUITE("Instrumentation") {
+    using namespace Webxx;
+
+    struct Greeting : component<Greeting> {
+        Greeting (std::string_view name) : component<Greeting> {
+            {
+                {".greeting", color{"green"}},
+            },
+            p{{_class{"greeting"}}, "Hello ", name},
+        } {}
+    };
+
+    TEST_CASE("Component type names are readable") {
+        CHECK(internal::typeName<Greeting>().find("Greeting") != std::string_view::npos);
+    }
+
+    TEST_CASE("Render stats are aggregated into a report") {
+        html page {
+            head {
+                styleTarget{},
+            },
+            body {
+                Greeting{"a"},
+                Greeting{"b"},
+                lazy{[] () { return p{"Deferred"}; }},
+            },
+        };
+
+        renderStats stats;
+        std::size_t entered{0};
+        std::size_t exited{0};
+        stats.observer.onComponentEnter = [&entered] (internal::ComponentTypeId, std::string_view name) {
+            CHECK(name.find("Greeting") != std::string_view::npos);
+            ++entered;
+        };
+        stats.observer.onComponentExit = [&exited] (internal::ComponentTypeId, std::string_view) {
+            ++exited;
+        };
+
+        internal::RenderOptions options;
+        options.stats = &stats;
+        const std::string output = render(page, std::move(options));
+
+        const renderReport& report = stats.report;
+        CHECK(report.bytes == output.size());
+        CHECK(report.sinkCalls > 0);
+        CHECK(report.lazies == 1);
+        CHECK(report.collectedCss == 1);
+        CHECK(report.collectedHeads == 0);
+        // html, head, style, body, 2x (component, p, 2x text), lazy + its p + text:
+        CHECK(report.nodes == 15);
+
+        REQUIRE(report.components.size() == 1);
+        const auto& greeting = report.components.begin()->second;
+        CHECK(greeting.name.find("Greeting") != std::string_view::npos);
+        CHECK(greeting.renders == 2);
+        CHECK(entered == 2);
+        CHECK(exited == 2);
+    }
+}
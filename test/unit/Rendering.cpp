@@ -0,0 +1,353 @@
+#include "doctest/doctest.h"
+#include "webxx.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+TEST_SUITE("Rendering") {
+    using namespace Webxx;
+
+    std::vector<std::size_t> rowNumbers (std::size_t count) {
+        std::vector<std::size_t> tRows(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            tRows[i] = i;
+        }
+        return tRows;
+    }
+
+    ol numberedList (const std::vector<std::size_t>& tRows) {
+        return ol{each(tRows, [] (std::size_t row) {
+            return li{{_class{"row"}}, std::to_string(row)};
+        })};
+    }
+
+    rule stripeRule (std::size_t) {
+        return {".stripe", backgroundColor{"rebeccapurple"}, color{"white"}, margin{"0 auto"}};
+    }
+
+    // A component with a large stylesheet, of a rule for each index:
+    struct Striped : component<Striped> {
+        Striped () : Striped(std::make_index_sequence<1500>{}) {}
+
+        template<std::size_t... N>
+        Striped (std::index_sequence<N...>) : component<Striped>{
+            {stripeRule(N)...},
+            dv{{_class{"stripe"}}},
+        } {}
+    };
+
+    TEST_CASE("Resumable render pauses while the sink would block") {
+        const std::vector<std::size_t> tRows = rowNumbers(100);
+        std::string received;
+        std::size_t offers{0};
+
+        auto rendering = renderResumable(numberedList(tRows), [&received, &offers] (std::string& pending) {
+            // Accept every other offer:
+            if (offers++ % 2 == 0) {
+                return SinkStatus::WOULD_BLOCK;
+            }
+            received.append(pending);
+            pending.clear();
+            return SinkStatus::READY;
+        }, {nullptr, internal::renderToInternalBuffer, 256});
+
+        std::size_t pauses{0};
+        while (!rendering.done()) {
+            ++pauses;
+            rendering.resume();
+        }
+
+        CHECK(pauses > 1);
+        CHECK(received == render(numberedList(tRows)));
+    }
+
+    TEST_CASE("Resumable render can be finished without pausing") {
+        std::string received;
+        auto rendering = renderResumable(numberedList(rowNumbers(3)), [&received] (std::string& pending) {
+            received.append(pending);
+            pending.clear();
+            return SinkStatus::READY;
+        });
+
+        CHECK(rendering.done());
+        CHECK(received == render(numberedList(rowNumbers(3))));
+    }
+
+    struct Leaf : component<Leaf> {
+        Leaf () : component<Leaf> {
+            {{".leaf", color{"red"}}},
+            span{{_class{"leaf"}}, lazy{[] () { return "deep"; }}},
+        } {}
+    };
+
+    TEST_CASE("Deeply nested documents can be collected & rendered") {
+        // Far deeper than would be safe to recurse through on a small stack:
+        constexpr std::size_t depth{10000};
+        internal::HtmlNode nested = Leaf{};
+        for (std::size_t i = 0; i < depth; ++i) {
+            nested = dv{std::move(nested)};
+        }
+
+        const std::string rendered = render(fragment{styleTarget{}, std::move(nested)});
+        const std::string scope = "data-c" + std::to_string(internal::compileTimeTypeId<Leaf>);
+        const std::string styles = "<style>.leaf[" + scope + "]{color:red;}</style>";
+        const std::string leaf = "<span class=\"leaf\" " + scope + ">deep</span>";
+
+        CHECK(rendered.size() == styles.size() + depth * std::string("<div></div>").size() + leaf.size());
+        CHECK(rendered.find(styles) == 0);
+        CHECK(rendered.find(leaf) == styles.size() + depth * std::string("<div>").size());
+    }
+
+    TEST_CASE("Cached fragments are rendered once per locale") {
+        fragmentCache cache;
+        std::size_t produced{0};
+        auto page = [&cache, &produced] () {
+            return dv{
+                cached{cache, [&produced] () {
+                    ++produced;
+                    return nav{a{{_title{_{"home"}}}, _{"home"}}};
+                }},
+                p{_{"home"}},
+            };
+        };
+        auto renderIn = [&page] (std::size_t locale, std::string_view home) {
+            internal::RenderOptions options{[home] (const std::string_view&, const std::string_view&) {
+                return home;
+            }};
+            options.placeholderLocale = locale;
+            return render(page(), std::move(options));
+        };
+
+        CHECK(renderIn(1, "Hem") == "<div><nav><a title=\"Hem\">Hem</a></nav><p>Hem</p></div>");
+        CHECK(renderIn(1, "Ignored") == "<div><nav><a title=\"Hem\">Hem</a></nav><p>Ignored</p></div>");
+        CHECK(produced == 1);
+        CHECK(renderIn(2, "Hjem") == "<div><nav><a title=\"Hjem\">Hjem</a></nav><p>Hjem</p></div>");
+        CHECK(produced == 2);
+
+        SUBCASE("Cached fragments are rendered again once invalidated") {
+            cache.invalidate();
+            CHECK(renderIn(1, "Hemma") == "<div><nav><a title=\"Hemma\">Hemma</a></nav><p>Hemma</p></div>");
+            CHECK(produced == 3);
+        }
+
+        SUBCASE("Cached fragments aren't used without a locale") {
+            CHECK(render(page()) == "<div><nav><a title=\"home\">home</a></nav><p>home</p></div>");
+            CHECK(produced == 3);
+        }
+    }
+
+    TEST_CASE("Cached fragments with collected styles are never cached") {
+        fragmentCache cache;
+        std::size_t produced{0};
+        auto page = [&cache, &produced] () {
+            return fragment{styleTarget{}, cached{cache, [&produced] () {
+                ++produced;
+                return Leaf{};
+            }}};
+        };
+        auto renderCached = [&page] () {
+            internal::RenderOptions options;
+            options.placeholderLocale = 1;
+            return render(page(), std::move(options));
+        };
+
+        const std::string first = renderCached();
+        CHECK(renderCached() == first);
+        CHECK(first.find(".leaf[") != std::string::npos);
+        CHECK(produced == 2);
+    }
+
+    TEST_CASE("Cached fragments containing a collection target are never cached") {
+        fragmentCache cache;
+        std::size_t produced{0};
+        auto page = [&cache, &produced] (internal::HtmlNode&& content) {
+            return fragment{
+                cached{cache, [&produced] () {
+                    ++produced;
+                    return head{styleTarget{}};
+                }},
+                std::move(content),
+            };
+        };
+        auto renderCached = [&page] (internal::HtmlNode&& content) {
+            internal::RenderOptions options;
+            options.placeholderLocale = 1;
+            return render(page(std::move(content)), std::move(options));
+        };
+
+        CHECK(renderCached(p{"plain"}) == "<head><style></style></head><p>plain</p>");
+        CHECK(renderCached(Leaf{}).find(".leaf[") != std::string::npos);
+        CHECK(produced == 2);
+    }
+
+    TEST_CASE("Cached fragments inside lazy ranges are rendered once per locale") {
+        fragmentCache cache;
+        std::size_t produced{0};
+        const std::vector<std::size_t> tRows = rowNumbers(3);
+        auto page = [&cache, &produced, &tRows] () {
+            return ul{eachLazy(tRows, [&cache, &produced] (std::size_t) {
+                return li{cached{cache, [&produced] () {
+                    ++produced;
+                    return a{_{"home"}};
+                }}};
+            })};
+        };
+        auto renderIn = [&page] (std::size_t locale) {
+            internal::RenderOptions options;
+            options.placeholderPopulator = [] (const std::string_view&, const std::string_view&) {
+                return std::string_view{"Hem"};
+            };
+            options.placeholderLocale = locale;
+            return render(page(), std::move(options));
+        };
+
+        const std::string expected = "<ul><li><a>Hem</a></li><li><a>Hem</a></li><li><a>Hem</a></li></ul>";
+        CHECK(renderIn(1) == expected);
+        const std::size_t first = produced;
+        CHECK(renderIn(1) == expected);
+        CHECK(produced == first);
+    }
+
+    std::string minified (internal::HtmlNode&& node, const std::size_t locale = 0) {
+        internal::RenderOptions options;
+        options.minify = true;
+        options.placeholderLocale = locale;
+        return render(std::move(node), std::move(options));
+    }
+
+    static constexpr char fancyElTag[] = "fancy-el";
+    using fancyEl = el<fancyElTag>;
+
+    TEST_CASE("Minified render leaves out optional end tags") {
+        CHECK(minified(table{tr{td{"a"}, th{"b"}}, tr{td{"c"}}}) == "<table><tr><td>a<th>b<tr><td>c</table>");
+        CHECK(minified(table{thead{tr{th{"a"}}}, tbody{tr{td{"b"}}}}) == "<table><thead><tr><th>a<tbody><tr><td>b</table>");
+        CHECK(minified(Webxx::select{option{"a"}, option{"b"}}) == "<select><option>a<option>b</select>");
+        CHECK(minified(ul{li{"a"}, fragment{li{"b"}}}) == "<ul><li>a<li>b</ul>");
+        CHECK(minified(li{"a"}) == "<li>a</li>");
+
+        SUBCASE("Minified render only leaves out </p> where it is implied") {
+            CHECK(minified(dv{p{"a"}, p{"b"}, ul{li{"c"}}, p{"d"}}) == "<div><p>a<p>b<ul><li>c</ul><p>d</div>");
+            CHECK(minified(dv{p{"a"}, span{"b"}, p{"c"}, "d"}) == "<div><p>a</p><span>b</span><p>c</p>d</div>");
+            CHECK(minified(a{p{"a"}}) == "<a><p>a</p></a>");
+            CHECK(minified(fancyEl{p{"a"}}) == "<fancy-el><p>a</p></fancy-el>");
+        }
+
+        SUBCASE("Minified render only leaves out </thead> before a <tbody> or <tfoot>") {
+            CHECK(minified(table{thead{tr{th{"a"}}}}) == "<table><thead><tr><th>a</thead></table>");
+        }
+
+        SUBCASE("Minified render leaves out the ends of the document") {
+            CHECK(minified(doc{html{head{title{"a"}}, body{p{"b"}}}}) == "<!doctype html><html><head><title>a</title><body><p>b");
+        }
+    }
+
+    TEST_CASE("Cached fragments are kept apart for minified renders") {
+        fragmentCache cache;
+        auto badge = [&cache] () {
+            return cached{cache, [] () {
+                return span{{_class{"b"}}, "b"};
+            }};
+        };
+        auto renderCached = [] (internal::HtmlNode&& node) {
+            internal::RenderOptions options;
+            options.placeholderLocale = 1;
+            return render(std::move(node), std::move(options));
+        };
+
+        CHECK(renderCached(dv{badge()}) == "<div><span class=\"b\">b</span></div>");
+        CHECK(minified(dv{badge()}, 1) == "<div><span class=b>b</span></div>");
+
+        SUBCASE("Cached fragments don't hold the end tag left out before them") {
+            cache.invalidate();
+            CHECK(minified(dv{p{"a"}, badge()}, 1) == "<div><p>a</p><span class=b>b</span></div>");
+            CHECK(minified(dv{badge()}, 1) == "<div><span class=b>b</span></div>");
+        }
+    }
+
+    TEST_CASE("Minified render leaves out attribute quotes & values where possible") {
+        CHECK(minified(input{{_type{"checkbox"}, _checked{"checked"}, _class{"a", "b"}, _title{"a b"}, _value{""}, _name{"x"}}})
+            == "<input type=checkbox checked class=\"a b\" title=\"a b\" value=\"\" name=x>");
+        CHECK(minified(Webxx::link{{_href{"/a=b"}}}) == "<link href=\"/a=b\">");
+        CHECK(minified(dv{{_hidden{"until-found"}, _disabled{"Disabled"}, _selected{""}}}) == "<div hidden=until-found disabled selected></div>");
+        CHECK(render(input{{_checked{"checked"}}}) == "<input checked=\"checked\"/>");
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    struct PipedRender {
+        std::string received;
+        std::size_t pauses;
+        std::size_t mostBuffered;
+    };
+
+    // Render into a non-blocking pipe, resuming whenever the pipe has been
+    // emptied, like a server would once the fd became writable:
+    PipedRender renderIntoPipe (internal::HtmlNode&& node, const std::size_t bufferSize) {
+        int fds[2];
+        REQUIRE(pipe(fds) == 0);
+        REQUIRE(fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+        REQUIRE(fcntl(fds[1], F_SETFL, O_NONBLOCK) == 0);
+
+        PipedRender result{{}, 0, 0};
+        auto rendering = renderResumable(std::move(node), [&fds, &result] (std::string& pending) {
+            result.mostBuffered = std::max(result.mostBuffered, pending.size());
+            while (!pending.empty()) {
+                const ssize_t written = write(fds[1], pending.data(), pending.size());
+                if (written < 0) {
+                    return SinkStatus::WOULD_BLOCK;
+                }
+                pending.erase(0, static_cast<std::size_t>(written));
+            }
+            return SinkStatus::READY;
+        }, {nullptr, internal::renderToInternalBuffer, bufferSize});
+
+        auto readAvailable = [&fds, &result] () {
+            char chunk[4096];
+            ssize_t size;
+            while ((size = read(fds[0], chunk, sizeof(chunk))) > 0) {
+                result.received.append(chunk, static_cast<std::size_t>(size));
+            }
+        };
+
+        while (!rendering.done()) {
+            ++result.pauses;
+            readAvailable();
+            rendering.resume();
+        }
+        readAvailable();
+        close(fds[0]);
+        close(fds[1]);
+        return result;
+    }
+
+    TEST_CASE("Resumable render into a non-blocking pipe buffers a bounded amount") {
+        // Several times the capacity of a pipe, so that writing it must block:
+        const std::vector<std::size_t> tRows = rowNumbers(20000);
+        constexpr std::size_t bufferSize{4 * 1024};
+        const PipedRender piped = renderIntoPipe(numberedList(tRows), bufferSize);
+
+        CHECK(piped.pauses > 0);
+        CHECK(piped.received == render(numberedList(tRows)));
+        // The render only pauses between nodes, so can overshoot by one node's output:
+        CHECK(piped.mostBuffered < bufferSize + 64);
+    }
+
+    TEST_CASE("Resumable render into a non-blocking pipe pauses within a collected stylesheet") {
+        // The collected CSS alone is larger than the capacity of a pipe:
+        constexpr std::size_t bufferSize{1024};
+        const PipedRender piped = renderIntoPipe(html{head{styleTarget{}}, body{Striped{}}}, bufferSize);
+
+        const std::string expected = render(html{head{styleTarget{}}, body{Striped{}}});
+        CHECK(expected.find("</style>") > 64 * 1024);
+        CHECK(piped.pauses > 0);
+        CHECK(piped.received == expected);
+        // Collected CSS is rendered a rule at a time, so can overshoot by one rule's output:
+        CHECK(piped.mostBuffered < bufferSize + 128);
+    }
+#endif
+}
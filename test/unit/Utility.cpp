@@ -2,6 +2,9 @@
 #include "fmt/core.h"
 #include "webxx.h"
 
+#include <iterator>
+#include <sstream>
+
 TEST_SUITE("Utility") {
     using namespace Webxx;
 
@@ -127,7 +130,7 @@ TEST_SUITE("Utility") {
                 "<li data-c{0}>1 simple trick</li>"
                 "<li data-c{0}>Is C++ dead? 💀</li>"
             "</ol>",
-            (PostEl({})).data.componentTypeId
+            (PostEl({})).data.componentTypeId()
         ));
     }
 
@@ -158,4 +161,108 @@ TEST_SUITE("Utility") {
             "</ol>"
         );
     }
-}
\ No newline at end of file
+
+    // Kept separate as the component helpers above move out of posts:
+    const std::vector<Post> lazyPosts{
+        {"...", "Lazy evaluation", "", ""},
+        {"...", "Lazy loading", "", ""},
+        {"...", "Lazy developers", "", ""}
+    };
+
+    TEST_CASE("Each lazy only produces nodes while rendering") {
+        std::size_t produced{0};
+        ol myList {
+            eachLazy(lazyPosts, [&produced] (const Post& post) {
+                ++produced;
+                return li{post.title};
+            }),
+        };
+
+        CHECK(produced == 0);
+        CHECK(render(myList) ==
+            "<ol>"
+                "<li>Lazy evaluation</li>"
+                "<li>Lazy loading</li>"
+                "<li>Lazy developers</li>"
+            "</ol>"
+        );
+        CHECK(produced == 3);
+
+        SUBCASE("Each lazy is walked once more to collect, when there is a target") {
+            produced = 0;
+            render(fragment{styleTarget{}, std::move(myList)});
+            // Once while collecting (e.g. component styles), then again while rendering:
+            CHECK(produced == 6);
+        }
+    }
+
+    TEST_CASE("Loop lazy over a range without size") {
+        struct Words {
+            std::istringstream& in;
+            std::istream_iterator<std::string> begin () { return std::istream_iterator<std::string>{in}; }
+            std::istream_iterator<std::string> end () { return {}; }
+        };
+        std::istringstream in{"a b c"};
+        std::size_t produced{0};
+
+        ul myList {
+            loopLazy(Words{in}, [&produced] (const std::string& word, const Loop& loop) {
+                ++produced;
+                return li{fmt::format("{}{}/{}", word, loop.index, loop.count)};
+            }),
+        };
+
+        // Input ranges can only be walked once, so their count is unknown:
+        CHECK(render(myList) == "<ul><li>a0/0</li><li>b1/0</li><li>c2/0</li></ul>");
+        CHECK(produced == 3);
+    }
+
+    struct LazyPostEl : component<LazyPostEl> {
+        LazyPostEl (const Post& post, const Loop& loop) : component<LazyPostEl> {
+            {{".post", color{"red"}}},
+            li { {_class{"post"}}, post.title, lazy{[index = loop.index] () { return std::to_string(index); }} },
+        } {}
+    };
+
+    TEST_CASE("Loop lazy with component collects its styles") {
+        const std::string rendered = render(fragment{
+            styleTarget{},
+            ol{loopLazy<LazyPostEl>(lazyPosts)},
+        });
+        const auto componentId = internal::compileTimeTypeId<LazyPostEl>;
+
+        CHECK(rendered == fmt::format(
+            "<style>.post[data-c{0}]{{color:red;}}</style>"
+            "<ol>"
+                "<li class=\"post\" data-c{0}>Lazy evaluation0</li>"
+                "<li class=\"post\" data-c{0}>Lazy loading1</li>"
+                "<li class=\"post\" data-c{0}>Lazy developers2</li>"
+            "</ol>",
+            componentId
+        ));
+    }
+
+    TEST_CASE("Stream rows in flushed batches") {
+        constexpr std::size_t rows{10};
+        std::vector<std::string> flushed;
+        const std::string rest = render(
+            ol{streamRows(4, [] (std::size_t row) -> std::optional<li> {
+                if (row == rows) {
+                    return std::nullopt;
+                }
+                return li{std::to_string(row)};
+            })},
+            {nullptr, internal::renderToInternalBuffer, 0, [&flushed] (std::string& buffer) {
+                flushed.push_back(buffer);
+                buffer.clear();
+            }}
+        );
+
+        // Each batch is drained as it is flushed, so the buffer never holds more than one:
+        REQUIRE(flushed.size() == 3);
+        CHECK(flushed[0] == "<ol><li>0</li><li>1</li><li>2</li><li>3</li>");
+        CHECK(flushed[1] == "<li>4</li><li>5</li><li>6</li><li>7</li>");
+        CHECK(flushed[2] == "<li>8</li><li>9</li>");
+        CHECK(rest == "</ol>");
+    }
+}